@@ -0,0 +1,150 @@
+#include "pch.h"
+
+using namespace std;
+using namespace std::chrono;
+
+/**
+	Hivemind.Headless
+
+	Runs the simulation without a window so that it can be profiled, benchmarked and regression tested on any machine.
+	The world is stepped a fixed number of times and the wall time and throughput are reported on completion.
+
+	Usage: Hivemind.Headless [world.json] [ticks] [timestep] [threads] [wasp cap]
+	       Hivemind.Headless --dance [idle bees] [known food sources] [dances]
+
+	Running the same world and seed with a different thread count must report the same populations; only the wall
+	time should change.
+
+	The --dance mode skips the world entirely and times Hive::CompleteWaggleDance on a single synthetic hive.
+*/
+
+const uint32_t DEFAULT_TICKS = 3600;
+const uint32_t DEFAULT_DANCE_BEES = 10000;
+const uint32_t DEFAULT_DANCE_FOOD_SOURCES = 1000;
+const uint32_t DEFAULT_DANCES = 20;
+
+/**
+ * Prints one line of pool counters: capacity, peak live objects and the share of creations that recycled storage
+ */
+void PrintPoolStatistics(const string& label, const PoolStatistics& statistics)
+{
+	cout << label << statistics.GetCapacity() << " slots, peak " << statistics.GetHighWaterMark()
+		<< ", recycled " << statistics.GetRecycleRate() * 100.0f << "%" << endl;
+}
+
+/**
+ * Times the waggle dance of one hive that knows about every food source and has every onlooker waiting on it.
+ * Resetting the bees to idle and reporting the food sources happens outside the timed region
+ */
+int RunDanceBenchmark(const uint32_t& idleBees, const uint32_t& foodSources, const uint32_t& dances)
+{
+	World::GetInstance()->SetHeadless(true);
+
+	auto& hive = HiveManager::GetInstance()->SpawnHive(sf::Vector2f(0.0f, 0.0f));
+	auto foodSourceManager = FoodSourceManager::GetInstance();
+	auto rowLength = static_cast<uint32_t>(sqrt(foodSources)) + 1;
+	for (uint32_t i = 0; i < foodSources; ++i)
+	{	// Lay the food sources out on a grid so that each one is a different distance from the hive
+		foodSourceManager->SpawnFoodSource(sf::Vector2f((i % rowLength) * 300.0f, (i / rowLength + 1) * 300.0f));
+	}
+
+	auto beeManager = BeeManager::GetInstance();
+	for (uint32_t i = 0; i < idleBees; ++i)
+	{
+		beeManager->SpawnOnlooker(hive.GetCenterTarget(), hive);
+	}
+
+	double danceTime = 0.0;
+	for (uint32_t i = 0; i < dances; ++i)
+	{
+		for (auto iter = beeManager->OnlookerBegin(); iter != beeManager->OnlookerEnd(); ++iter)
+		{
+			(*iter)->SetState(Bee::State::Idle);
+			hive.AddIdleBee(*iter);
+		}
+		for (auto iter = foodSourceManager->Begin(); iter != foodSourceManager->End(); ++iter)
+		{
+			auto distance = Entity::DistanceBetween((*iter)->GetCenterTarget(), hive.GetCenterTarget());
+			hive.UpdateKnownFoodSource((*iter)->GetHandle(), make_pair((*iter)->GetFoodAmount(), distance));
+		}
+
+		auto danceStart = steady_clock::now();
+		hive.CompleteWaggleDance();
+		danceTime += duration<double>(steady_clock::now() - danceStart).count();
+	}
+
+	auto danceCount = dances > 0 ? dances : 1;
+	cout << fixed << setprecision(3);
+	cout << "Idle bees:    " << idleBees << endl;
+	cout << "Food sources: " << foodSources << endl;
+	cout << "Dances:       " << dances << endl;
+	cout << "Total time:   " << danceTime << "s" << endl;
+	cout << "Per dance:    " << danceTime * 1000.0 / danceCount << "ms" << endl;
+	cout << "Per bee:      " << (idleBees > 0 ? danceTime * 1.0e9 / danceCount / idleBees : 0.0) << "ns" << endl;
+
+	return EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc >= 2 && string(argv[1]) == "--dance")
+	{
+		return RunDanceBenchmark(
+			argc >= 3 ? static_cast<uint32_t>(stoul(argv[2])) : DEFAULT_DANCE_BEES,
+			argc >= 4 ? static_cast<uint32_t>(stoul(argv[3])) : DEFAULT_DANCE_FOOD_SOURCES,
+			argc >= 5 ? static_cast<uint32_t>(stoul(argv[4])) : DEFAULT_DANCES);
+	}
+
+	string worldConfig = argc >= 2 ? argv[1] : "big_world.json";
+	uint32_t ticks = argc >= 3 ? static_cast<uint32_t>(stoul(argv[2])) : DEFAULT_TICKS;
+	double timestep = argc >= 4 ? stod(argv[3]) : SimulationClock::DEFAULT_TIMESTEP;
+	uint32_t threads = argc >= 5 ? static_cast<uint32_t>(stoul(argv[4])) : thread::hardware_concurrency();
+	uint32_t waspCap = argc >= 6 ? static_cast<uint32_t>(stoul(argv[5])) : WaspManager::DEFAULT_WASP_CAP;
+
+	auto world = World::GetInstance();
+	world->SetHeadless(true);
+	world->GetClock().SetTimestep(timestep);
+	world->SetThreadCount(threads);
+	WaspManager::GetInstance()->SetWaspCap(waspCap);
+
+	auto loadStart = steady_clock::now();
+	world->Load(worldConfig);
+	auto loadTime = duration<double>(steady_clock::now() - loadStart).count();
+
+	auto runStart = steady_clock::now();
+	for (uint32_t i = 0; i < ticks; ++i)
+	{	// No real time to wait on, so step as fast as the machine allows
+		world->Step();
+	}
+	auto runTime = duration<double>(steady_clock::now() - runStart).count();
+
+	auto beeManager = BeeManager::GetInstance();
+
+	cout << fixed << setprecision(3);
+	cout << "World:        " << worldConfig << endl;
+	cout << "Seed:         " << world->GetSeed() << endl;
+	cout << "Ticks:        " << ticks << " @ " << timestep << "s" << endl;
+	cout << "Threads:      " << world->GetThreadPool().GetThreadCount() << endl;
+	cout << "Load time:    " << loadTime << "s" << endl;
+	cout << "Wall time:    " << runTime << "s" << endl;
+	cout << "Ticks/sec:    " << (runTime > 0.0 ? ticks / runTime : 0.0) << endl;
+	cout << "Sim time:     " << world->GetClock().GetElapsedTime() << "s" << endl;
+	cout << "Hives:        " << HiveManager::GetInstance()->GetHiveCount() << endl;
+	cout << "Food sources: " << FoodSourceManager::GetInstance()->GetFoodSourceCount() << endl;
+	cout << "Onlookers:    " << beeManager->OnlookerCount() << endl;
+	cout << "Employees:    " << beeManager->EmployeeCount() << endl;
+	cout << "Drones:       " << beeManager->DroneCount() << endl;
+	cout << "Guards:       " << beeManager->GuardCount() << endl;
+	cout << "Queens:       " << beeManager->QueenCount() << endl;
+	cout << "Larva:        " << beeManager->LarvaCount() << endl;
+	cout << "Wasps:        " << WaspManager::GetInstance()->GetWaspCount() << endl;
+	PrintPoolStatistics("Onlooker pool:", beeManager->GetPoolStatistics(Bee::Type::Onlooker));
+	PrintPoolStatistics("Employee pool:", beeManager->GetPoolStatistics(Bee::Type::Employee));
+	PrintPoolStatistics("Drone pool:   ", beeManager->GetPoolStatistics(Bee::Type::Drone));
+	PrintPoolStatistics("Guard pool:   ", beeManager->GetPoolStatistics(Bee::Type::Guard));
+	PrintPoolStatistics("Queen pool:   ", beeManager->GetPoolStatistics(Bee::Type::Queen));
+	PrintPoolStatistics("Larva pool:   ", beeManager->GetPoolStatistics(Bee::Type::Larva));
+	PrintPoolStatistics("Wasp pool:    ", WaspManager::GetInstance()->GetPoolStatistics());
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+
+//////////////////////////////
+//  Program Dependencies  ///
+////////////////////////////
+#include <cstdlib>
+#include <SFML/Graphics.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <iostream>
+#include <math.h>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <fstream>
+#include <rapidjson/document.h>
+#include <random>
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+// The simulation core is platform independent; only the desktop front end pulls in windows.h
+#ifndef UNREFERENCED_PARAMETER
+#define UNREFERENCED_PARAMETER(P) (void)(P)
+#endif
+
+
+///////////////////////////
+//  Local Dependencies  //
+/////////////////////////
+#include "BeeManager.h"
+#include "FoodSourceManager.h"
+#include "FlowFieldManager.h"
+#include "FlowField.h"
+#include "FontManager.h"
+#include "HiveManager.h"
+#include "Hive.h"
+#include "FoodSource.h"
+#include "OnlookerBee.h"
+#include "EmployedBee.h"
+#include "QueenBee.h"
+#include "Drone.h"
+#include "Guard.h"
+#include "Larva.h"
+#include "CollisionNode.h"
+#include "CollisionGrid.h"
+#include "HiveHUD.h"
+#include "Wasp.h"
+#include "WaspManager.h"
+#include "PerlinNoise.h"
+#include "SimulationClock.h"
+#include "RandomStream.h"
+#include "ThreadPool.h"
+#include "ObjectPool.h"
+#include "Handle.h"
+#include "AliasTable.h"
+#include "FoodSourceKnowledge.h"
+#include "BeeRenderer.h"
+#include "DensityMap.h"
+#include "TripleBuffer.h"
+#include "WorldSnapshot.h"
+#include "TextLayer.h"
+#include "WorldRenderer.h"
+#include "World.h"
\ No newline at end of file
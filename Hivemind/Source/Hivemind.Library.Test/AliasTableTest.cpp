@@ -0,0 +1,102 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(AliasTableTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(AliasTable_Empty)
+		{
+			AliasTable table;
+			Assert::IsTrue(table.IsEmpty());
+
+			// Weights that sum to zero leave nothing to sample
+			table.Build(std::vector<float>{ 0.0f, 0.0f });
+			Assert::IsTrue(table.IsEmpty());
+			Assert::AreEqual(0U, table.Size());
+
+			table.Build(std::vector<float>{ 0.0f, 2.0f });
+			Assert::IsFalse(table.IsEmpty());
+			Assert::AreEqual(2U, table.Size());
+		}
+
+		TEST_METHOD(AliasTable_Distribution)
+		{
+			AliasTable table;
+			table.Build(std::vector<float>{ 1.0f, 0.0f, 3.0f, 4.0f });
+
+			RandomStream stream(1337, RandomStream::Hive, 0);
+			std::uint32_t counts[4] = { 0, 0, 0, 0 };
+			const std::uint32_t sampleCount = 80000;
+			for (std::uint32_t i = 0; i < sampleCount; i++)
+			{
+				counts[table.Sample(stream)]++;
+			}
+
+			// Exactly one value is drawn per sample
+			Assert::AreEqual(static_cast<std::uint64_t>(sampleCount), stream.GetCounter());
+
+			// Outcomes with no weight are never chosen, and the rest come up in proportion to their weight
+			Assert::AreEqual(0U, counts[1]);
+			Assert::AreEqual(0.125f, static_cast<float>(counts[0]) / sampleCount, 0.01f);
+			Assert::AreEqual(0.375f, static_cast<float>(counts[2]) / sampleCount, 0.01f);
+			Assert::AreEqual(0.5f, static_cast<float>(counts[3]) / sampleCount, 0.01f);
+		}
+
+		TEST_METHOD(AliasTable_Rebuild)
+		{
+			AliasTable table;
+			table.Build(std::vector<float>{ 1.0f, 1.0f, 1.0f });
+
+			// Rebuilding replaces the old outcomes entirely
+			table.Build(std::vector<float>{ 0.0f, 5.0f });
+			Assert::AreEqual(2U, table.Size());
+
+			RandomStream stream(1337, RandomStream::Hive, 1);
+			for (int i = 0; i < 1000; i++)
+			{
+				Assert::AreEqual(1U, table.Sample(stream));
+			}
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState AliasTableTest::sStartMemState;
+}
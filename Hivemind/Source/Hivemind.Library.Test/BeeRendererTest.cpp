@@ -0,0 +1,106 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(BeeRendererTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(BeeRenderer_Batch)
+		{
+			BeeRenderer renderer;
+			Assert::AreEqual(0U, renderer.GetBeeCount());
+			Assert::IsTrue(renderer.GetVertices().empty());
+
+			// A body is an outline disc and a fill disc, each a fan of triangles
+			auto discVertices = BeeRenderer::CIRCLE_SEGMENTS * 3;
+			renderer.AddBee(sf::Vector2f(10.0f, 20.0f), 12.0f, sf::Color::Yellow, sf::Color::Red, 0.0f, 0.0f);
+			Assert::AreEqual(1U, renderer.GetBeeCount());
+			Assert::AreEqual(static_cast<std::size_t>(discVertices * 2), renderer.GetVertices().size());
+
+			// A face adds one quad
+			renderer.AddBee(sf::Vector2f(0.0f, 0.0f), 12.0f, sf::Color::Yellow, sf::Color::Red, 12.0f, 0.0f);
+			Assert::AreEqual(2U, renderer.GetBeeCount());
+			Assert::AreEqual(static_cast<std::size_t>(discVertices * 4 + 6), renderer.GetVertices().size());
+
+			// Clearing keeps nothing from the previous frame
+			renderer.Clear();
+			Assert::AreEqual(0U, renderer.GetBeeCount());
+			Assert::IsTrue(renderer.GetVertices().empty());
+		}
+
+		TEST_METHOD(BeeRenderer_Geometry)
+		{
+			BeeRenderer renderer;
+			sf::Vector2f center(100.0f, -50.0f);
+			renderer.AddBee(center, 12.0f, sf::Color::Yellow, sf::Color::Red, 12.0f, 1.5707963f);
+
+			// The outline comes first and reaches the full radius, then the fill is drawn inside it
+			auto& vertices = renderer.GetVertices();
+			auto discVertices = BeeRenderer::CIRCLE_SEGMENTS * 3;
+			for (std::uint32_t i = 0; i < discVertices * 2; ++i)
+			{
+				auto offset = vertices[i].position - center;
+				auto distance = std::sqrt(offset.x * offset.x + offset.y * offset.y);
+				if (i < discVertices)
+				{
+					Assert::IsTrue(vertices[i].color == sf::Color::Red);
+					Assert::IsTrue(distance <= 12.0f + 0.001f);
+				}
+				else
+				{
+					Assert::IsTrue(vertices[i].color == sf::Color::Yellow);
+					Assert::IsTrue(distance <= 12.0f - BeeRenderer::OUTLINE_THICKNESS + 0.001f);
+				}
+			}
+
+			// Facing straight down, the face runs from the center to one body radius below it
+			auto& faceCenter = vertices[discVertices * 2];
+			auto& faceTip = vertices[discVertices * 2 + 1];
+			Assert::IsTrue(faceCenter.color == sf::Color::White);
+			Assert::AreEqual(center.x, faceCenter.position.x, 0.001f);
+			Assert::AreEqual(center.y, faceCenter.position.y, 0.001f);
+			Assert::AreEqual(center.x, faceTip.position.x, 0.001f);
+			Assert::AreEqual(center.y + 12.0f, faceTip.position.y, 0.001f);
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState BeeRendererTest::sStartMemState;
+}
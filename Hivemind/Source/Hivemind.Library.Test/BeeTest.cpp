@@ -17,6 +17,7 @@ namespace HivemindLibraryTest
 			{"Collision", L"Invalid Collision Detection"},
 			{"Nullptr Expected", L"Method was expecting to return nullptr but did not"},
 			{"Default Expected", L"Method was expecting to return a default value but did not"},
+			{"Allocation", L"Collision query allocated memory"},
 		};
 
 		static void InitializeLeakDetection()
@@ -48,6 +49,12 @@ namespace HivemindLibraryTest
 			Hive hive(position);
 			FooBee bee(position, hive);
 			FoodSource fs(position);
+
+			// Initialize the grid and its node map ahead of the allocation checks
+			auto grid = CollisionGrid::GetInstance();
+			grid->CollisionNodeFromPosition(position)->RegisterFoodSource(&fs);
+			grid->CollisionNodeFromPosition(position)->UnregisterFoodSource(&fs);
+			grid->ReleaseEmptyNodes();
 		}
 
 		TEST_METHOD_INITIALIZE(MethodInitialize)
@@ -166,6 +173,17 @@ namespace HivemindLibraryTest
 			Assert::AreEqual(target, bee.GetTarget());
 		}
 
+		TEST_METHOD(Bee_DefaultTarget)
+		{
+			// A new bee's target is where it spawned, so it does not head for the origin before it is given one
+			sf::Vector2f position(250, -75);
+			Hive hive(sf::Vector2f(0, 0));
+			FooBee bee(position, hive);
+
+			Assert::AreEqual(position, bee.GetTarget());
+			Assert::IsFalse(bee.HasTarget());
+		}
+
 		TEST_METHOD(Bee_HasTarget)
 		{
 			sf::Vector2f position(0, 0);
@@ -231,6 +249,39 @@ namespace HivemindLibraryTest
 			Assert::AreEqual(Bee::State::Scouting, bee.GetState());
 		}
 
+		TEST_METHOD(Bee_CollidingWithNearbyFoodSource)
+		{
+			sf::Vector2f origin(0, 0);
+			Hive hive(origin);
+			FoodSource foodSource(origin);
+			auto node = CollisionGrid::GetInstance()->CollisionNodeFromPosition(origin);
+			node->RegisterFoodSource(&foodSource);
+
+			FooBee bee(foodSource.GetCenterTarget(), hive);
+			bee.RefreshCollisionCell();
+			sf::Vector2f farCorner = origin + sf::Vector2f(static_cast<float>(node->GetSize() - 1), static_cast<float>(node->GetSize() - 1));
+
+#if _DEBUG
+			_CrtMemState beforeQuery, afterQuery;
+			_CrtMemCheckpoint(&beforeQuery);
+#endif
+			// Found in the bee's own node
+			bool collidingAtCenter = bee.CollidingWithNearbyFoodSource();
+			bee.SetPosition(farCorner);
+
+			// Nothing in the 3x3 block around the bee overlaps it
+			bool collidingAtCorner = bee.CollidingWithNearbyFoodSource();
+#if _DEBUG
+			_CrtMemCheckpoint(&afterQuery);
+			Assert::IsTrue(beforeQuery.lTotalCount == afterQuery.lTotalCount, Message["Allocation"]);
+#endif
+
+			Assert::IsTrue(collidingAtCenter, Message["Collision"]);
+			Assert::IsFalse(collidingAtCorner, Message["Collision"]);
+			node->UnregisterFoodSource(&foodSource);
+			CollisionGrid::GetInstance()->ReleaseEmptyNodes();
+		}
+
 		static _CrtMemState sStartMemState;
 	};
 
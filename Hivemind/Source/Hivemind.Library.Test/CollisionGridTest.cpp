@@ -0,0 +1,211 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(CollisionGridTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_CLASS_INITIALIZE(ClassInitialize)
+		{
+			// Initialize the grid and grow its node map once so neither shows up during leak detection
+			FoodSource foodSource(sf::Vector2f(0, 0));
+			auto grid = CollisionGrid::GetInstance();
+			for (int i = 0; i < 16; i++)
+			{
+				grid->CollisionNodeFromPosition(sf::Vector2f(i * 1000000.0f, 0.0f))->RegisterFoodSource(&foodSource);
+			}
+			for (int i = 0; i < 16; i++)
+			{
+				grid->CollisionNodeFromPosition(sf::Vector2f(i * 1000000.0f, 0.0f))->UnregisterFoodSource(&foodSource);
+			}
+			grid->ReleaseEmptyNodes();
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(CollisionGrid_AllocatesOnDemand)
+		{
+			auto grid = CollisionGrid::GetInstance();
+			auto nodeCount = grid->GetNodeCount();
+
+			// Far outside the bounds of the old fixed grid
+			sf::Vector2f position(3000000.0f, -4000000.0f);
+			auto cell = grid->CellFromPosition(position);
+			Assert::IsNull(grid->FindCollisionNode(cell));
+
+			FoodSource foodSource(position);
+			auto node = grid->CollisionNodeFromPosition(position);
+			node->RegisterFoodSource(&foodSource);
+			Assert::AreEqual(cell, node->GetCell());
+			Assert::IsTrue(node->ContainsPoint(position));
+			Assert::IsTrue(node == grid->FindCollisionNode(cell));
+			Assert::AreEqual(nodeCount + 1, grid->GetNodeCount());
+
+			// Occupied nodes survive the sweep
+			grid->ReleaseEmptyNodes();
+			Assert::IsTrue(node == grid->FindCollisionNode(cell));
+
+			node->UnregisterFoodSource(&foodSource);
+			grid->ReleaseEmptyNodes();
+			Assert::IsNull(grid->FindCollisionNode(cell));
+			Assert::AreEqual(nodeCount, grid->GetNodeCount());
+		}
+
+		TEST_METHOD(CollisionGrid_QueryAround)
+		{
+			auto grid = CollisionGrid::GetInstance();
+			float size = static_cast<float>(grid->GetNodeSize());
+			sf::Vector2f center(size / 2.0f, size / 2.0f);
+			FoodSource foodSource(center);
+
+			auto centerNode = grid->CollisionNodeFromPosition(center);
+			auto leftNode = grid->CollisionNodeFromPosition(center - sf::Vector2f(size, 0.0f));
+			auto bottomRightNode = grid->CollisionNodeFromPosition(center + sf::Vector2f(size, size));
+			centerNode->RegisterFoodSource(&foodSource);
+			leftNode->RegisterFoodSource(&foodSource);
+			bottomRightNode->RegisterFoodSource(&foodSource);
+
+			// Only allocated neighbors are reported
+			auto neighbors = grid->NeighborsOf(centerNode);
+			Assert::AreEqual(2U, neighbors.size());
+
+			std::uint32_t visited = 0;
+			bool endedEarly = grid->QueryAround(center, [&visited](const CollisionNode& node)
+			{
+				visited += static_cast<std::uint32_t>(node.FoodSources().size());
+				return false;
+			});
+			Assert::IsFalse(endedEarly);
+			Assert::AreEqual(3U, visited);
+
+			// The center cell is always visited first
+			visited = 0;
+			endedEarly = grid->QueryAround(center, [&visited](const CollisionNode&)
+			{
+				visited++;
+				return true;
+			});
+			Assert::IsTrue(endedEarly);
+			Assert::AreEqual(1U, visited);
+
+			centerNode->UnregisterFoodSource(&foodSource);
+			leftNode->UnregisterFoodSource(&foodSource);
+			bottomRightNode->UnregisterFoodSource(&foodSource);
+			grid->ReleaseEmptyNodes();
+		}
+
+		TEST_METHOD(CollisionGrid_QueryRegion)
+		{
+			auto grid = CollisionGrid::GetInstance();
+			float size = static_cast<float>(grid->GetNodeSize());
+			sf::Vector2f center(size / 2.0f, size / 2.0f);
+			FoodSource foodSource(center);
+
+			auto centerNode = grid->CollisionNodeFromPosition(center);
+			auto farNode = grid->CollisionNodeFromPosition(center + sf::Vector2f(size * 3, size * 2));
+			auto outsideNode = grid->CollisionNodeFromPosition(center + sf::Vector2f(size * 5, 0.0f));
+			centerNode->RegisterFoodSource(&foodSource);
+			farNode->RegisterFoodSource(&foodSource);
+			outsideNode->RegisterFoodSource(&foodSource);
+
+			// Every allocated cell the box touches is visited, however far it is from the first
+			std::uint32_t visited = 0;
+			bool endedEarly = grid->QueryRegion(center, center + sf::Vector2f(size * 3, size * 2), [&visited](const CollisionNode& node)
+			{
+				visited += static_cast<std::uint32_t>(node.FoodSources().size());
+				return false;
+			});
+			Assert::IsFalse(endedEarly);
+			Assert::AreEqual(2U, visited);
+
+			// A box within a single cell only visits that cell
+			visited = 0;
+			endedEarly = grid->QueryRegion(center, center, [&visited](const CollisionNode&)
+			{
+				visited++;
+				return true;
+			});
+			Assert::IsTrue(endedEarly);
+			Assert::AreEqual(1U, visited);
+
+			centerNode->UnregisterFoodSource(&foodSource);
+			farNode->UnregisterFoodSource(&foodSource);
+			outsideNode->UnregisterFoodSource(&foodSource);
+			grid->ReleaseEmptyNodes();
+		}
+
+		TEST_METHOD(CollisionGrid_QueryVisible)
+		{
+			auto grid = CollisionGrid::GetInstance();
+			float size = static_cast<float>(grid->GetNodeSize());
+			sf::Vector2f center(size / 2.0f, size / 2.0f);
+			FoodSource foodSource(center);
+
+			auto centerNode = grid->CollisionNodeFromPosition(center);
+			auto nearNode = grid->CollisionNodeFromPosition(center + sf::Vector2f(size, 0.0f));
+			auto outsideNode = grid->CollisionNodeFromPosition(center + sf::Vector2f(size * 5, size * 5));
+			centerNode->RegisterFoodSource(&foodSource);
+			nearNode->RegisterFoodSource(&foodSource);
+			outsideNode->RegisterFoodSource(&foodSource);
+
+			// An area spanning fewer cells than are allocated looks its cells up one by one
+			std::uint32_t visited = 0;
+			grid->QueryVisible(sf::FloatRect(center, sf::Vector2f(size, 0.0f)), [&visited](CollisionNode& node)
+			{
+				visited += static_cast<std::uint32_t>(node.FoodSources().size());
+			});
+			Assert::AreEqual(2U, visited);
+
+			// A larger area scans the allocated nodes instead, and still skips those outside it
+			visited = 0;
+			grid->QueryVisible(sf::FloatRect(-size * 10, -size * 10, size * 14, size * 14), [&visited](CollisionNode& node)
+			{
+				visited += static_cast<std::uint32_t>(node.FoodSources().size());
+			});
+			Assert::AreEqual(2U, visited);
+
+			centerNode->UnregisterFoodSource(&foodSource);
+			nearNode->UnregisterFoodSource(&foodSource);
+			outsideNode->UnregisterFoodSource(&foodSource);
+			grid->ReleaseEmptyNodes();
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState CollisionGridTest::sStartMemState;
+}
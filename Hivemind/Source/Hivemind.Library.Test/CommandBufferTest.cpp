@@ -0,0 +1,99 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(CommandBufferTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_CLASS_INITIALIZE(ClassInitialize)
+		{
+			// Initialize the hive's dependencies once so static initialization does not happen during leak detection
+			Hive hive(sf::Vector2f(0, 0));
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(CommandBuffer_Record)
+		{
+			Hive hive(sf::Vector2f(0, 0));
+			CommandBuffer commands;
+			Assert::AreEqual(0U, commands.Size());
+
+			commands.SpawnBee(Bee::Type::Guard, sf::Vector2f(1, 2), hive);
+			commands.SpawnLarva(sf::Vector2f(3, 4), hive, Larva::LarvaType::Drone);
+			commands.SpawnBee(Bee::Type::Guard, sf::Vector2f(5, 6), hive);
+			Assert::AreEqual(3U, commands.Size());
+			Assert::AreEqual(2U, commands.Count(Bee::Type::Guard));
+			Assert::AreEqual(1U, commands.Count(Bee::Type::Larva));
+			Assert::AreEqual(0U, commands.Count(Bee::Type::Onlooker));
+
+			auto larva = commands.Begin() + 1;
+			Assert::IsTrue(larva->mLarvaType == Larva::LarvaType::Drone);
+			Assert::AreEqual(sf::Vector2f(3, 4), larva->mPosition);
+			Assert::IsTrue(larva->mHive == &hive);
+
+			commands.Clear();
+			Assert::AreEqual(0U, commands.Size());
+		}
+
+		TEST_METHOD(CommandBuffer_Append)
+		{
+			Hive hive(sf::Vector2f(0, 0));
+			CommandBuffer first, second;
+			first.SpawnBee(Bee::Type::Onlooker, sf::Vector2f(1, 0), hive);
+			second.SpawnBee(Bee::Type::Employee, sf::Vector2f(2, 0), hive);
+			second.SpawnBee(Bee::Type::Queen, sf::Vector2f(3, 0), hive);
+
+			// Merged commands keep the order of the buffers they were appended from
+			first.Append(second);
+			Assert::AreEqual(3U, first.Size());
+			Assert::AreEqual(2U, second.Size());
+			Bee::Type expected[] = { Bee::Type::Onlooker, Bee::Type::Employee, Bee::Type::Queen };
+			std::uint32_t index = 0;
+			for (auto iter = first.Begin(); iter != first.End(); ++iter)
+			{
+				Assert::IsTrue(iter->mBeeType == expected[index]);
+				Assert::AreEqual(static_cast<float>(index + 1), iter->mPosition.x);
+				index++;
+			}
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState CommandBufferTest::sStartMemState;
+}
@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(DensityMapTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(DensityMap_Counts)
+		{
+			WorldSnapshot::BeeState bee = {};
+			sf::Vector2i centerCell(0, 0);
+			sf::Vector2i neighborCell(1, 0);
+			int size = CollisionGrid::DEFAULT_NODE_SIZE;
+			sf::FloatRect area(0.0f, 0.0f, size * 2.0f, static_cast<float>(size));
+
+			WorldSnapshot snapshot;
+			snapshot.Reset(size, 0);
+			snapshot.BeginCell(centerCell);
+			snapshot.AddBee(bee);
+			snapshot.AddBee(bee);
+			snapshot.BeginCell(neighborCell);
+			snapshot.AddBee(bee);
+
+			DensityMap densityMap;
+			Assert::AreEqual(0U, densityMap.GetCount(centerCell));
+
+			// The first update grows the map over both cells
+			densityMap.Update(snapshot, area);
+			Assert::AreEqual(2U, densityMap.GetCount(centerCell));
+			Assert::AreEqual(1U, densityMap.GetCount(neighborCell));
+			Assert::AreEqual(2U, densityMap.GetChangedCount());
+
+			// Nothing moved, so nothing is rewritten
+			densityMap.Update(snapshot, area);
+			Assert::AreEqual(0U, densityMap.GetChangedCount());
+
+			// Only the cell that lost a bee is rewritten
+			snapshot.Reset(size, 1);
+			snapshot.BeginCell(centerCell);
+			snapshot.AddBee(bee);
+			snapshot.BeginCell(neighborCell);
+			snapshot.AddBee(bee);
+			densityMap.Update(snapshot, area);
+			Assert::AreEqual(1U, densityMap.GetCount(centerCell));
+			Assert::AreEqual(1U, densityMap.GetChangedCount());
+
+			// An emptied cell is missing from the snapshot, but it is still cleared
+			snapshot.Reset(size, 2);
+			snapshot.BeginCell(centerCell);
+			snapshot.AddBee(bee);
+			densityMap.Update(snapshot, area);
+			Assert::AreEqual(0U, densityMap.GetCount(neighborCell));
+			Assert::AreEqual(1U, densityMap.GetChangedCount());
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState DensityMapTest::sStartMemState;
+}
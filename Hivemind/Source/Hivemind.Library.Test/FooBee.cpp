@@ -15,9 +15,13 @@ FooBee::~FooBee()
 {
 }
 
-void FooBee::Update(sf::RenderWindow& window, const double& deltaTime)
+void FooBee::Update(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
 	UNREFERENCED_PARAMETER(deltaTime);
 	// Do nothing. This is just an instantiable version of the abstract Bee class
 }
+
+void FooBee::RefreshCollisionCell()
+{
+	mCollisionCell = CollisionGrid::GetInstance()->CellFromPosition(GetPosition());
+}
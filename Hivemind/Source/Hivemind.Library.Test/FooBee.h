@@ -11,10 +11,10 @@ class FooBee : public Bee
 public:
 	explicit FooBee(const sf::Vector2f& position, Hive& hive);
 	~FooBee();
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
-protected:
-
-	virtual void PopulateFunctionMaps() override {}
+	// Test hooks for the protected collision queries
+	void RefreshCollisionCell();
+	using Bee::CollidingWithNearbyFoodSource;
 };
 
@@ -11,9 +11,8 @@ FooEntity::FooEntity(const sf::Vector2f& position, const sf::Color& outlineColor
 {
 }
 
-void FooEntity::Update(sf::RenderWindow& window, const double& deltaTime)
+void FooEntity::Update(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
 	UNREFERENCED_PARAMETER(deltaTime);
 }
 
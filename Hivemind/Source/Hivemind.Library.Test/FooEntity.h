@@ -15,7 +15,7 @@ public:
 
 	virtual ~FooEntity() = default;
 
-	virtual void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	virtual void Update(const double& deltaTime) override;
 	virtual void Render(sf::RenderWindow& window) const override;
 };
 
@@ -0,0 +1,159 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(FoodSourceKnowledgeTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(FoodSourceKnowledge_Lookup)
+		{
+			FoodSource foodSource(sf::Vector2f(0, 0));
+			HandleTable<FoodSource> handles(4);
+			auto first = handles.Issue(&foodSource);
+			auto second = handles.Issue(&foodSource);
+			auto third = handles.Issue(&foodSource);
+
+			FoodSourceKnowledge knowledge;
+			Assert::AreEqual(0U, knowledge.Size());
+			Assert::IsFalse(knowledge.Contains(first));
+			Assert::IsFalse(knowledge.Contains(Handle<FoodSource>()));
+
+			knowledge.Update(first, 10.0f, 100.0f);
+			knowledge.Update(second, 20.0f, 200.0f);
+			knowledge.Update(third, 30.0f, 300.0f);
+			Assert::AreEqual(3U, knowledge.Size());
+
+			// Reporting on a known food source overwrites its row rather than adding another
+			knowledge.Update(second, 25.0f, 250.0f);
+			Assert::AreEqual(3U, knowledge.Size());
+			Assert::IsTrue(second == knowledge.GetFoodSource(1));
+			Assert::AreEqual(25.0f, knowledge.GetYield(1));
+			Assert::AreEqual(250.0f, knowledge.GetDistance(1));
+
+			// Removing a row moves the last row into its place
+			knowledge.Remove(first);
+			Assert::AreEqual(2U, knowledge.Size());
+			Assert::IsFalse(knowledge.Contains(first));
+			Assert::IsTrue(knowledge.Contains(third));
+			Assert::IsTrue(third == knowledge.GetFoodSource(0));
+			Assert::AreEqual(30.0f, knowledge.GetYield(0));
+
+			// Removing something unknown does nothing
+			knowledge.Remove(first);
+			Assert::AreEqual(2U, knowledge.Size());
+
+			knowledge.Clear();
+			Assert::AreEqual(0U, knowledge.Size());
+			Assert::IsFalse(knowledge.Contains(second));
+			Assert::IsFalse(knowledge.Contains(third));
+		}
+
+		TEST_METHOD(FoodSourceKnowledge_ReusedSlot)
+		{
+			FoodSource foodSource(sf::Vector2f(0, 0));
+			HandleTable<FoodSource> handles(4);
+			auto expired = handles.Issue(&foodSource);
+
+			FoodSourceKnowledge knowledge;
+			knowledge.Update(expired, 50.0f, 500.0f);
+
+			handles.Release(expired);
+			auto replacement = handles.Issue(&foodSource);
+			Assert::AreEqual(expired.GetIndex(), replacement.GetIndex());
+
+			// A newer food source in the same slot is not mistaken for the old one, and replaces its row when reported
+			Assert::IsFalse(knowledge.Contains(replacement));
+			knowledge.Update(replacement, 5.0f, 50.0f);
+			Assert::AreEqual(1U, knowledge.Size());
+			Assert::IsFalse(knowledge.Contains(expired));
+			Assert::IsTrue(knowledge.Contains(replacement));
+			Assert::AreEqual(5.0f, knowledge.GetYieldRange().mMaximum);
+		}
+
+		TEST_METHOD(FoodSourceKnowledge_Ranges)
+		{
+			FoodSource foodSource(sf::Vector2f(0, 0));
+			HandleTable<FoodSource> handles(4);
+			auto first = handles.Issue(&foodSource);
+			auto second = handles.Issue(&foodSource);
+			auto third = handles.Issue(&foodSource);
+
+			FoodSourceKnowledge knowledge;
+			Assert::AreEqual(0.0f, knowledge.GetYieldRange().mSum);
+
+			knowledge.Update(first, 10.0f, 300.0f);
+			knowledge.Update(second, 20.0f, 100.0f);
+			knowledge.Update(third, 30.0f, 200.0f);
+			Assert::AreEqual(10.0f, knowledge.GetYieldRange().mMinimum);
+			Assert::AreEqual(30.0f, knowledge.GetYieldRange().mMaximum);
+			Assert::AreEqual(60.0f, knowledge.GetYieldRange().mSum);
+			Assert::AreEqual(100.0f, knowledge.GetDistanceRange().mMinimum);
+			Assert::AreEqual(300.0f, knowledge.GetDistanceRange().mMaximum);
+			Assert::AreEqual(600.0f, knowledge.GetDistanceRange().mSum);
+
+			// Moving an extreme inward hands it to whichever row now holds it
+			knowledge.Update(third, 15.0f, 200.0f);
+			Assert::AreEqual(10.0f, knowledge.GetYieldRange().mMinimum);
+			Assert::AreEqual(20.0f, knowledge.GetYieldRange().mMaximum);
+			Assert::AreEqual(45.0f, knowledge.GetYieldRange().mSum);
+
+			// Widening a range is picked up directly
+			knowledge.Update(second, 40.0f, 50.0f);
+			Assert::AreEqual(40.0f, knowledge.GetYieldRange().mMaximum);
+			Assert::AreEqual(50.0f, knowledge.GetDistanceRange().mMinimum);
+
+			// Removing the row that held an extreme does the same
+			knowledge.Remove(first);
+			Assert::AreEqual(15.0f, knowledge.GetYieldRange().mMinimum);
+			Assert::AreEqual(200.0f, knowledge.GetDistanceRange().mMaximum);
+			Assert::AreEqual(250.0f, knowledge.GetDistanceRange().mSum);
+
+			// An empty table has an empty range
+			knowledge.Remove(second);
+			knowledge.Remove(third);
+			Assert::AreEqual(0.0f, knowledge.GetYieldRange().mMinimum);
+			Assert::AreEqual(0.0f, knowledge.GetYieldRange().mMaximum);
+			Assert::AreEqual(0.0f, knowledge.GetYieldRange().mSum);
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState FoodSourceKnowledgeTest::sStartMemState;
+}
@@ -0,0 +1,175 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(HandleTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(Handle_FindAndRelease)
+		{
+			int first = 1, second = 2;
+			HandleTable<int> table(4);
+
+			// Null handles never resolve
+			Handle<int> nullHandle;
+			Assert::IsTrue(nullHandle.IsNull());
+			Assert::IsNull(table.Find(nullHandle));
+
+			auto firstHandle = table.Issue(&first);
+			auto secondHandle = table.Issue(&second);
+			Assert::IsTrue(firstHandle != secondHandle);
+			Assert::IsTrue(&first == table.Find(firstHandle));
+			Assert::IsTrue(&second == table.Find(secondHandle));
+			Assert::AreEqual(2U, table.GetLiveCount());
+
+			table.Release(firstHandle);
+			Assert::IsNull(table.Find(firstHandle));
+			Assert::IsTrue(&second == table.Find(secondHandle));
+			Assert::AreEqual(1U, table.GetLiveCount());
+
+			// Releasing a stale handle is ignored
+			table.Release(firstHandle);
+			Assert::AreEqual(1U, table.GetLiveCount());
+			table.Release(secondHandle);
+		}
+
+		TEST_METHOD(Handle_StaleAfterReuse)
+		{
+			int first = 1, second = 2;
+			HandleTable<int> table(4);
+
+			auto firstHandle = table.Issue(&first);
+			table.Release(firstHandle);
+
+			// The slot is reused, but the old handle is from an earlier generation
+			auto secondHandle = table.Issue(&second);
+			Assert::AreEqual(firstHandle.GetIndex(), secondHandle.GetIndex());
+			Assert::AreNotEqual(firstHandle.GetGeneration(), secondHandle.GetGeneration());
+			Assert::IsNull(table.Find(firstHandle));
+			Assert::IsTrue(&second == table.Find(secondHandle));
+
+			// Moving an entity only repoints its slot
+			int moved = 2;
+			table.Relocate(secondHandle, &moved);
+			Assert::IsTrue(&moved == table.Find(secondHandle));
+			table.Release(secondHandle);
+		}
+
+		TEST_METHOD(HandleSet_Membership)
+		{
+			int first = 1, second = 2, third = 3;
+			HandleTable<int> table(4);
+			auto firstHandle = table.Issue(&first);
+			auto secondHandle = table.Issue(&second);
+			auto thirdHandle = table.Issue(&third);
+
+			HandleSet<int> set;
+			Assert::IsTrue(set.IsEmpty());
+			Assert::IsFalse(set.Contains(Handle<int>()));
+
+			// Members are only added once
+			Assert::IsTrue(set.Insert(firstHandle));
+			Assert::IsTrue(set.Insert(secondHandle));
+			Assert::IsTrue(set.Insert(thirdHandle));
+			Assert::IsFalse(set.Insert(secondHandle));
+			Assert::AreEqual(3U, set.Size());
+
+			// Removing a member moves the last one into its place
+			Assert::IsTrue(set.Remove(firstHandle));
+			Assert::IsFalse(set.Remove(firstHandle));
+			Assert::IsFalse(set.Contains(firstHandle));
+			Assert::IsTrue(thirdHandle == *set.Begin());
+			Assert::IsTrue(set.Contains(secondHandle));
+			Assert::IsTrue(set.Contains(thirdHandle));
+
+			// A handle to a newer entity in the same slot is a different member, and replaces the stale one
+			table.Release(secondHandle);
+			auto reusedHandle = table.Issue(&first);
+			Assert::IsFalse(set.Contains(reusedHandle));
+			Assert::IsTrue(set.Insert(reusedHandle));
+			Assert::AreEqual(2U, set.Size());
+			Assert::IsFalse(set.Contains(secondHandle));
+			Assert::IsTrue(set.Contains(reusedHandle));
+
+			set.Clear();
+			Assert::IsTrue(set.IsEmpty());
+			Assert::IsFalse(set.Contains(thirdHandle));
+		}
+
+		TEST_METHOD(HandleSet_KeepIf)
+		{
+			int values[5] = { 0, 1, 2, 3, 4 };
+			HandleTable<int> table(5);
+			HandleSet<int> set;
+			for (auto& value : values)
+			{
+				set.Insert(table.Issue(&value));
+			}
+
+			// Every member is visited once, and the survivors keep their order
+			std::uint32_t visits = 0;
+			set.KeepIf([&table, &visits](const Handle<int>& handle)
+			{
+				visits++;
+				return *table.Find(handle) % 2 == 0;
+			});
+			Assert::AreEqual(5U, visits);
+			Assert::AreEqual(3U, set.Size());
+
+			int expected = 0;
+			for (auto iter = set.Begin(); iter != set.End(); ++iter)
+			{
+				Assert::AreEqual(expected, *table.Find(*iter));
+				Assert::IsTrue(set.Contains(*iter));
+				expected += 2;
+			}
+
+			// Positions are updated for the survivors, so removal still finds them
+			auto last = *(set.End() - 1);
+			Assert::IsTrue(set.Remove(*set.Begin()));
+			Assert::IsTrue(set.Remove(last));
+			Assert::AreEqual(1U, set.Size());
+			Assert::AreEqual(2, *table.Find(*set.Begin()));
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState HandleTest::sStartMemState;
+}
@@ -0,0 +1,127 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(HiveHUDTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(HiveHUD_Geometry)
+		{
+			int onlookers = 10, employees = 30, drones = 0, guards = 0, queens = 0;
+			float structuralComb = 2000.0f, honeyComb = 5000.0f, broodComb = 3000.0f, food = 2500.0f;
+			sf::Vector2f root(100, 200);
+			sf::Vector2f dimensions(400, 20);
+			HiveHUD hud(root, dimensions, onlookers, employees, drones, guards, queens, structuralComb, honeyComb,
+				broodComb, food);
+
+			const auto& vertices = hud.GetVertices();
+			Assert::AreEqual(HiveHUD::VERTEX_COUNT, static_cast<std::uint32_t>(vertices.size()));
+
+			// Onlookers take the first quarter of the bee row, and employees the rest of it
+			Assert::AreEqual(root.x, vertices[0].position.x);
+			Assert::AreEqual(root.x + 100.0f, vertices[1].position.x);
+			Assert::AreEqual(root.x + 100.0f, vertices[6].position.x);
+			Assert::AreEqual(root.x + 400.0f, vertices[7].position.x);
+
+			// Food fills half the honey comb, which is half the comb row
+			const auto& foodBar = vertices[8 * 6];
+			Assert::AreEqual(root.y + 2 * (dimensions.y + 4), foodBar.position.y);
+			Assert::AreEqual(root.x + 100.0f, vertices[8 * 6 + 1].position.x);
+		}
+
+		TEST_METHOD(HiveHUD_Threshold)
+		{
+			int onlookers = 100, employees = 100, drones = 0, guards = 0, queens = 0;
+			float structuralComb = 2000.0f, honeyComb = 5000.0f, broodComb = 3000.0f, food = 2500.0f;
+			HiveHUD hud(sf::Vector2f(0, 0), sf::Vector2f(400, 20), onlookers, employees, drones, guards, queens,
+				structuralComb, honeyComb, broodComb, food);
+
+			// Nothing changed, so nothing is rebuilt
+			Assert::IsFalse(hud.UpdateHUDValues());
+
+			// A change too small to see keeps the old geometry
+			food += 1.0f;
+			onlookers += 1;
+			Assert::IsFalse(hud.UpdateHUDValues());
+
+			// Small changes that add up past the threshold are drawn
+			food += 100.0f;
+			Assert::IsTrue(hud.UpdateHUDValues());
+			Assert::IsFalse(hud.UpdateHUDValues());
+
+			onlookers += 10;
+			Assert::IsTrue(hud.UpdateHUDValues());
+		}
+
+		TEST_METHOD(HiveHUD_Empty)
+		{
+			// A hive with no bees or comb draws empty bars rather than dividing by zero
+			int onlookers = 0, employees = 0, drones = 0, guards = 0, queens = 0;
+			float structuralComb = 0.0f, honeyComb = 0.0f, broodComb = 0.0f, food = 0.0f;
+			HiveHUD hud(sf::Vector2f(0, 0), sf::Vector2f(400, 20), onlookers, employees, drones, guards, queens,
+				structuralComb, honeyComb, broodComb, food);
+
+			for (const auto& vertex : hud.GetVertices())
+			{
+				Assert::IsFalse(std::isnan(vertex.position.x));
+			}
+			Assert::AreEqual(hud.GetVertices()[0].position.x, hud.GetVertices()[1].position.x);
+		}
+
+		TEST_METHOD(HiveHUD_AppendVertices)
+		{
+			int onlookers = 10, employees = 30, drones = 0, guards = 0, queens = 0;
+			float structuralComb = 2000.0f, honeyComb = 5000.0f, broodComb = 3000.0f, food = 2500.0f;
+			HiveHUD first(sf::Vector2f(0, 0), sf::Vector2f(400, 20), onlookers, employees, drones, guards, queens,
+				structuralComb, honeyComb, broodComb, food);
+			HiveHUD second(sf::Vector2f(1000, 0), sf::Vector2f(400, 20), onlookers, employees, drones, guards, queens,
+				structuralComb, honeyComb, broodComb, food);
+
+			std::vector<sf::Vertex> batch;
+			first.AppendVertices(batch);
+			second.AppendVertices(batch);
+			Assert::AreEqual(2 * HiveHUD::VERTEX_COUNT, static_cast<std::uint32_t>(batch.size()));
+			Assert::AreEqual(1000.0f, batch[HiveHUD::VERTEX_COUNT].position.x);
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState HiveHUDTest::sStartMemState;
+}
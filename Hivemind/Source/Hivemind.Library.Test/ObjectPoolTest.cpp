@@ -0,0 +1,140 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	/**
+	 * Counts its own constructions and destructions so the tests can tell when the pool runs them
+	 */
+	struct PooledCounter
+	{
+		explicit PooledCounter(int value) : mValue(value)
+		{
+			if (value < 0)
+			{
+				throw std::runtime_error("Negative value");
+			}
+			sAlive++;
+		}
+
+		~PooledCounter()
+		{
+			sAlive--;
+		}
+
+		int mValue;
+		static int sAlive;
+	};
+
+	int PooledCounter::sAlive = 0;
+
+	TEST_CLASS(ObjectPoolTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(ObjectPool_CreateDestroy)
+		{
+			ObjectPool<PooledCounter> pool(4);
+			Assert::AreEqual(0U, pool.GetStatistics().GetCapacity());
+
+			auto first = pool.Create(1);
+			auto second = pool.Create(2);
+			Assert::AreEqual(1, first->mValue);
+			Assert::AreEqual(2, second->mValue);
+			Assert::AreEqual(2, PooledCounter::sAlive);
+			Assert::AreEqual(4U, pool.GetStatistics().GetCapacity());
+			Assert::AreEqual(2U, pool.GetStatistics().GetLiveCount());
+
+			pool.Destroy(first);
+			pool.Destroy(second);
+			Assert::AreEqual(0, PooledCounter::sAlive);
+			Assert::AreEqual(0U, pool.GetStatistics().GetLiveCount());
+			Assert::AreEqual(2U, pool.GetStatistics().GetHighWaterMark());
+		}
+
+		TEST_METHOD(ObjectPool_Recycle)
+		{
+			ObjectPool<PooledCounter> pool(2);
+
+			// A destroyed object's slot is handed to the next creation
+			auto first = pool.Create(1);
+			pool.Destroy(first);
+			auto second = pool.Create(2);
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(pool.GetStatistics().GetRecycleCount()));
+			Assert::AreEqual(0.5f, pool.GetStatistics().GetRecycleRate());
+
+			// Running dry carves another slab rather than moving live objects
+			auto third = pool.Create(3);
+			auto fourth = pool.Create(4);
+			Assert::AreEqual(4U, pool.GetStatistics().GetCapacity());
+			Assert::AreEqual(2, second->mValue);
+
+			pool.Destroy(second);
+			pool.Destroy(third);
+			pool.Destroy(fourth);
+			Assert::AreEqual(0, PooledCounter::sAlive);
+		}
+
+		TEST_METHOD(ObjectPool_ConstructorThrows)
+		{
+			ObjectPool<PooledCounter> pool(4);
+
+			// A failed creation on fresh storage leaves nothing behind, and the slot is not later counted as reused
+			Assert::ExpectException<std::runtime_error>([&pool] { pool.Create(-1); });
+			Assert::AreEqual(0U, pool.GetStatistics().GetLiveCount());
+			auto first = pool.Create(1);
+			Assert::AreEqual(0ULL, static_cast<unsigned long long>(pool.GetStatistics().GetRecycleCount()));
+			Assert::AreEqual(4U, pool.GetStatistics().GetCapacity());
+
+			// A failed creation on recycled storage hands that storage to the next creation
+			pool.Destroy(first);
+			Assert::ExpectException<std::runtime_error>([&pool] { pool.Create(-1); });
+			auto second = pool.Create(2);
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(pool.GetStatistics().GetRecycleCount()));
+			Assert::AreEqual(2ULL, static_cast<unsigned long long>(pool.GetStatistics().GetCreateCount()));
+
+			pool.Destroy(second);
+			Assert::AreEqual(0, PooledCounter::sAlive);
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ObjectPoolTest::sStartMemState;
+}
@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(RandomStreamTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(RandomStream_Deterministic)
+		{
+			RandomStream lhs(1337, RandomStream::Bee, 42);
+			RandomStream rhs(1337, RandomStream::Bee, 42);
+			for (int i = 0; i < 100; i++)
+			{
+				Assert::IsTrue(lhs() == rhs());
+			}
+			Assert::AreEqual(static_cast<std::uint64_t>(100), lhs.GetCounter());
+		}
+
+		TEST_METHOD(RandomStream_IndependentStreams)
+		{
+			RandomStream stream(1337, RandomStream::Bee, 42);
+			Assert::IsTrue(stream() != RandomStream(1337, RandomStream::Bee, 43)());
+			Assert::IsTrue(RandomStream(1337, RandomStream::Bee, 42)() != RandomStream(1337, RandomStream::Wasp, 42)());
+			Assert::IsTrue(RandomStream(1337, RandomStream::Bee, 42)() != RandomStream(1338, RandomStream::Bee, 42)());
+		}
+
+		TEST_METHOD(RandomStream_Fork)
+		{
+			RandomStream stream(1337, RandomStream::Hive, 0);
+			auto child = stream.Fork(7);
+
+			// Drawing from the parent must not change the children it hands out
+			stream();
+			stream();
+			Assert::IsTrue(child() == stream.Fork(7)());
+			Assert::IsTrue(stream.Fork(7)() != stream.Fork(8)());
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState RandomStreamTest::sStartMemState;
+}
@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(SimulationClockTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(SimulationClock_Step)
+		{
+			SimulationClock clock(0.5);
+			Assert::AreEqual(0.0, clock.GetElapsedTime());
+
+			clock.Step();
+			clock.Step();
+			Assert::AreEqual(1.0, clock.GetElapsedTime());
+			Assert::AreEqual(static_cast<std::uint64_t>(2), clock.GetTickCount());
+
+			clock.Reset();
+			Assert::AreEqual(0.0, clock.GetElapsedTime());
+			Assert::AreEqual(static_cast<std::uint64_t>(0), clock.GetTickCount());
+		}
+
+		TEST_METHOD(SimulationClock_Accumulate)
+		{
+			SimulationClock clock(0.25);
+
+			// Partial steps are banked until a full step is due
+			Assert::AreEqual(0u, clock.Accumulate(0.125));
+			Assert::AreEqual(1u, clock.Accumulate(0.125));
+			Assert::AreEqual(4u, clock.Accumulate(1.0));
+
+			// Accumulating never advances the clock on its own
+			Assert::AreEqual(0.0, clock.GetElapsedTime());
+		}
+
+		TEST_METHOD(SimulationClock_TimeScale)
+		{
+			SimulationClock clock(0.25);
+			clock.SetTimeScale(8.0);
+			Assert::AreEqual(32u, clock.Accumulate(1.0));
+
+			clock.SetTimeScale(0.0);
+			Assert::AreEqual(0u, clock.Accumulate(1.0));
+		}
+
+		TEST_METHOD(SimulationClock_MaxStepsPerFrame)
+		{
+			SimulationClock clock(0.25);
+			clock.SetMaxStepsPerFrame(10);
+			Assert::AreEqual(10u, clock.Accumulate(100.0));
+
+			// The backlog from the slow frame is dropped
+			Assert::AreEqual(0u, clock.Accumulate(0.0));
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState SimulationClockTest::sStartMemState;
+}
@@ -0,0 +1,140 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(TextLayerTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_CLASS_INITIALIZE(ClassInitialize)
+		{
+			// Load the font once so the singleton is not counted as a leak
+			FontManager::GetInstance();
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(TextLayer_LayoutOnChange)
+		{
+			sf::RenderWindow window;
+			TextLayer layer(16);
+			int formatCount = 0;
+			auto format = [&formatCount](std::ostream& stream)
+			{
+				stream << "Label";
+				++formatCount;
+			};
+			TextLayer::Values values = { 1, 2, 3, 4 };
+			sf::Vector2f position(0, 0);
+
+			// A new label is laid out as soon as it is drawn
+			layer.BeginFrame(0);
+			layer.Draw(window, 7, position, values, format);
+			Assert::AreEqual(1U, layer.GetLayoutCount());
+			Assert::AreEqual(1, formatCount);
+
+			// Unchanged values keep the label as it is
+			layer.BeginFrame(TextLayer::REFRESH_INTERVAL);
+			layer.Draw(window, 7, position, values, format);
+			Assert::AreEqual(0U, layer.GetLayoutCount());
+			Assert::AreEqual(1, formatCount);
+
+			// A change is laid out once the refresh interval has passed
+			values[2] = 5;
+			layer.BeginFrame(TextLayer::REFRESH_INTERVAL);
+			layer.Draw(window, 7, position, values, format);
+			Assert::AreEqual(1U, layer.GetLayoutCount());
+			Assert::AreEqual(2, formatCount);
+		}
+
+		TEST_METHOD(TextLayer_Throttle)
+		{
+			sf::RenderWindow window;
+			TextLayer layer(16);
+			int formatCount = 0;
+			auto format = [&formatCount](std::ostream& stream)
+			{
+				stream << "Label";
+				++formatCount;
+			};
+			TextLayer::Values values = { 0, 0, 0, 0 };
+			sf::Vector2f position(0, 0);
+
+			layer.BeginFrame(0);
+			layer.Draw(window, 7, position, values, format);
+
+			// Values changing every frame faster than the display refreshes are only laid out once per interval
+			for (std::uint32_t frame = 1; frame <= 8; ++frame)
+			{
+				values[0] = frame;
+				layer.BeginFrame(TextLayer::REFRESH_INTERVAL / 4.0);
+				layer.Draw(window, 7, position, values, format);
+			}
+			Assert::AreEqual(3, formatCount);
+		}
+
+		TEST_METHOD(TextLayer_Eviction)
+		{
+			sf::RenderWindow window;
+			TextLayer layer(16);
+			auto format = [](std::ostream& stream)
+			{
+				stream << "Label";
+			};
+			TextLayer::Values values = { 0, 0, 0, 0 };
+			sf::Vector2f position(0, 0);
+
+			layer.BeginFrame(0);
+			layer.Draw(window, 1, position, values, format);
+			layer.Draw(window, 2, position, values, format);
+			Assert::AreEqual(2U, layer.GetLabelCount());
+
+			// A label that is not drawn for a whole frame is dropped
+			layer.BeginFrame(0);
+			layer.Draw(window, 1, position, values, format);
+			layer.BeginFrame(0);
+			Assert::AreEqual(1U, layer.GetLabelCount());
+
+			// And laid out afresh when it comes back into view
+			layer.Draw(window, 2, position, values, format);
+			Assert::AreEqual(1U, layer.GetLayoutCount());
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState TextLayerTest::sStartMemState;
+}
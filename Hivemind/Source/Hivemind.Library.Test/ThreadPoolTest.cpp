@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(ThreadPoolTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(ThreadPool_ParallelFor)
+		{
+			ThreadPool pool(4);
+			std::vector<int> visits(1000, 0);
+			pool.ParallelFor(static_cast<std::uint32_t>(visits.size()), [&](std::uint32_t index)
+			{
+				visits[index]++;
+			}, 7);
+
+			// Every index is handed out exactly once, no matter who ends up stealing it
+			for (auto iter = visits.begin(); iter != visits.end(); ++iter)
+			{
+				Assert::AreEqual(1, *iter);
+			}
+		}
+
+		TEST_METHOD(ThreadPool_SingleThread)
+		{
+			ThreadPool pool(1);
+			std::vector<std::uint32_t> order;
+			pool.ParallelFor(100, [&](std::uint32_t index)
+			{
+				order.push_back(index);
+			});
+
+			Assert::AreEqual(static_cast<std::size_t>(100), order.size());
+			for (std::uint32_t i = 0; i < order.size(); i++)
+			{
+				Assert::AreEqual(i, order[i]);
+			}
+		}
+
+		TEST_METHOD(ThreadPool_SetThreadCount)
+		{
+			ThreadPool pool(0);
+			Assert::AreEqual(static_cast<std::uint32_t>(1), pool.GetThreadCount());
+
+			pool.SetThreadCount(3);
+			Assert::AreEqual(static_cast<std::uint32_t>(3), pool.GetThreadCount());
+
+			std::atomic<std::uint32_t> total(0);
+			pool.ParallelFor(500, [&](std::uint32_t index)
+			{
+				total += index;
+			}, 1);
+			Assert::AreEqual(static_cast<std::uint32_t>(499 * 500 / 2), total.load());
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ThreadPoolTest::sStartMemState;
+}
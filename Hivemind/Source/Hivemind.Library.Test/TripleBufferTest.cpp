@@ -0,0 +1,97 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(TripleBufferTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(TripleBuffer_PublishRead)
+		{
+			TripleBuffer<int> buffer;
+			Assert::AreEqual(0, buffer.ReadBuffer());
+
+			// Nothing is read until it is published
+			buffer.WriteBuffer() = 1;
+			Assert::AreEqual(0, buffer.ReadBuffer());
+			buffer.Publish();
+			Assert::AreEqual(1, buffer.ReadBuffer());
+
+			// The reader keeps its value while the writer fills another slot
+			buffer.WriteBuffer() = 2;
+			Assert::AreEqual(1, buffer.ReadBuffer());
+
+			// Only the latest of several publishes is read, and reading again without a publish keeps it
+			buffer.Publish();
+			buffer.WriteBuffer() = 3;
+			buffer.Publish();
+			Assert::AreEqual(3, buffer.ReadBuffer());
+			Assert::AreEqual(3, buffer.ReadBuffer());
+			Assert::AreEqual(3ULL, static_cast<unsigned long long>(buffer.GetPublishCount()));
+		}
+
+		TEST_METHOD(TripleBuffer_Threads)
+		{
+			// Each value is written whole before it is published, so the reader never sees a torn pair
+			TripleBuffer<std::pair<int, int>> buffer;
+			const int count = 10000;
+			std::thread writer([&buffer, count]
+			{
+				for (int i = 1; i <= count; ++i)
+				{
+					buffer.WriteBuffer() = std::make_pair(i, -i);
+					buffer.Publish();
+				}
+			});
+
+			int last = 0;
+			while (last < count)
+			{
+				const auto& value = buffer.ReadBuffer();
+				Assert::AreEqual(value.first, -value.second);
+				Assert::IsTrue(value.first >= last);
+				last = value.first;
+			}
+			writer.join();
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState TripleBufferTest::sStartMemState;
+}
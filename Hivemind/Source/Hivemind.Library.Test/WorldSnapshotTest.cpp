@@ -0,0 +1,123 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace HivemindLibraryTest
+{
+	TEST_CLASS(WorldSnapshotTest)
+	{
+	public:
+
+		static void InitializeLeakDetection()
+		{
+#if _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif //_DEBUG
+		}
+
+		/// Detects if memory state has been corrupted
+		static void FinalizeLeakDetection()
+		{
+#if _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif //_DEBUG
+		}
+
+		TEST_METHOD_INITIALIZE(MethodInitialize)
+		{
+			InitializeLeakDetection();
+		}
+
+		TEST_METHOD_CLEANUP(MethodCleanup)
+		{
+			FinalizeLeakDetection();
+		}
+
+		TEST_METHOD(WorldSnapshot_Cells)
+		{
+			WorldSnapshot::BeeState bee = {};
+			WorldSnapshot::WaspState wasp = {};
+			WorldSnapshot::HiveState hive = {};
+			hive.mId = 3;
+
+			WorldSnapshot snapshot;
+			snapshot.Reset(100, 42);
+			snapshot.BeginCell(sf::Vector2i(0, 0));
+			snapshot.AddHive(hive);
+			snapshot.AddBee(bee);
+			snapshot.AddBee(bee);
+			snapshot.BeginCell(sf::Vector2i(-1, 2));
+			snapshot.AddBee(bee);
+			snapshot.AddWasp(wasp);
+
+			Assert::AreEqual(42ULL, static_cast<unsigned long long>(snapshot.GetTickCount()));
+			Assert::AreEqual(2U, static_cast<uint32_t>(snapshot.Cells().size()));
+			Assert::AreEqual(3U, static_cast<uint32_t>(snapshot.Bees().size()));
+
+			// Each cell holds a contiguous range of every entity list
+			const auto& first = snapshot.Cells()[0];
+			Assert::AreEqual(0U, first.mFirstBee);
+			Assert::AreEqual(2U, first.mBeeCount);
+			Assert::AreEqual(1U, first.mHiveCount);
+			Assert::AreEqual(3U, snapshot.Hives()[first.mFirstHive].mId);
+			const auto& second = snapshot.Cells()[1];
+			Assert::AreEqual(2U, second.mFirstBee);
+			Assert::AreEqual(1U, second.mBeeCount);
+			Assert::AreEqual(0U, second.mHiveCount);
+			Assert::AreEqual(1U, second.mWaspCount);
+
+			// Cells are found by their coordinates, and empty cells are not there at all
+			Assert::IsTrue(snapshot.FindCell(sf::Vector2i(-1, 2)) == &second);
+			Assert::IsNull(snapshot.FindCell(sf::Vector2i(1, 0)));
+
+			// A cell can only be started once per capture
+			Assert::ExpectException<std::runtime_error>([&snapshot] { snapshot.BeginCell(sf::Vector2i(0, 0)); });
+
+			// Resetting empties every list, so entities need a cell again before they can be added
+			snapshot.Reset(100, 43);
+			Assert::AreEqual(0U, static_cast<uint32_t>(snapshot.Cells().size()));
+			Assert::AreEqual(0U, static_cast<uint32_t>(snapshot.Bees().size()));
+			Assert::ExpectException<std::runtime_error>([&snapshot, &bee] { snapshot.AddBee(bee); });
+		}
+
+		TEST_METHOD(WorldSnapshot_QueryVisible)
+		{
+			WorldSnapshot snapshot;
+			snapshot.Reset(100, 0);
+			snapshot.BeginCell(sf::Vector2i(0, 0));
+			snapshot.BeginCell(sf::Vector2i(1, 0));
+			snapshot.BeginCell(sf::Vector2i(5, 5));
+			Assert::AreEqual(sf::Vector2i(-1, 1), snapshot.CellFromPosition(sf::Vector2f(-0.5f, 150.0f)));
+
+			// A small area looks up its own cells
+			uint32_t visited = 0;
+			snapshot.QueryVisible(sf::FloatRect(50.0f, 50.0f, 100.0f, 10.0f), [&visited](const WorldSnapshot::CellState& cell)
+			{
+				Assert::AreEqual(0, cell.mCell.y);
+				++visited;
+			});
+			Assert::AreEqual(2U, visited);
+
+			// An area spanning more cells than the snapshot holds scans its cells instead
+			visited = 0;
+			snapshot.QueryVisible(sf::FloatRect(-10000.0f, -10000.0f, 10050.0f, 10050.0f), [&visited](const WorldSnapshot::CellState& cell)
+			{
+				Assert::AreEqual(sf::Vector2i(0, 0), cell.mCell);
+				++visited;
+			});
+			Assert::AreEqual(1U, visited);
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState WorldSnapshotTest::sStartMemState;
+}
@@ -32,6 +32,21 @@
 #include "Drone.h"
 #include "Guard.h"
 #include "Larva.h"
+#include "CollisionNode.h"
+#include "CollisionGrid.h"
+#include "SimulationClock.h"
+#include "RandomStream.h"
+#include "ThreadPool.h"
+#include "ObjectPool.h"
+#include "Handle.h"
+#include "AliasTable.h"
+#include "FoodSourceKnowledge.h"
+#include "BeeRenderer.h"
+#include "DensityMap.h"
+#include "TripleBuffer.h"
+#include "WorldSnapshot.h"
+#include "TextLayer.h"
+#include "WorldRenderer.h"
 
 
 /////////////////////////////////
@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "AliasTable.h"
+
+
+using namespace std;
+
+AliasTable::AliasTable() :
+	mProbabilities(), mAliases(), mScaled(), mSmall(), mLarge()
+{
+}
+
+void AliasTable::Build(const vector<float>& weights)
+{
+	mProbabilities.clear();
+	mAliases.clear();
+
+	double sum = 0.0;
+	for (auto iter = weights.begin(); iter != weights.end(); ++iter)
+	{
+		assert(*iter >= 0.0f);
+		sum += *iter;
+	}
+
+	if (sum <= 0.0)
+	{	// Nothing can be chosen, so leave the table empty
+		return;
+	}
+
+	auto count = static_cast<uint32_t>(weights.size());
+	mProbabilities.resize(count, 1.0f);
+	mAliases.resize(count);
+	mScaled.resize(count);
+	mSmall.clear();
+	mLarge.clear();
+
+	// Scale every weight so the average is one, then sort the columns into those that need topping up and those
+	// that have probability to spare
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		mAliases[i] = i;
+		mScaled[i] = static_cast<float>(weights[i] * count / sum);
+		if (mScaled[i] < 1.0f)
+		{
+			mSmall.push_back(i);
+		}
+		else
+		{
+			mLarge.push_back(i);
+		}
+	}
+
+	while (!mSmall.empty() && !mLarge.empty())
+	{	// Fill the rest of a short column from a tall one
+		auto small = mSmall.back();
+		mSmall.pop_back();
+		auto large = mLarge.back();
+
+		mProbabilities[small] = mScaled[small];
+		mAliases[small] = large;
+
+		mScaled[large] = (mScaled[large] + mScaled[small]) - 1.0f;
+		if (mScaled[large] < 1.0f)
+		{
+			mLarge.pop_back();
+			mSmall.push_back(large);
+		}
+	}
+
+	// Whatever is left over is only short or tall by rounding error, so those columns always keep their own outcome
+}
+
+uint32_t AliasTable::Sample(RandomStream& generator) const
+{
+	assert(!IsEmpty());
+
+	// The high half of the draw picks the column and the low 24 bits are the coin that decides between the column's
+	// own outcome and its alias
+	auto bits = generator();
+	auto column = static_cast<uint32_t>(((bits >> 32) * mProbabilities.size()) >> 32);
+	auto coin = static_cast<float>(bits & 0xFFFFFF) * (1.0f / 16777216.0f);
+	return (coin < mProbabilities[column]) ? column : mAliases[column];
+}
+
+uint32_t AliasTable::Size() const
+{
+	return static_cast<uint32_t>(mProbabilities.size());
+}
+
+bool AliasTable::IsEmpty() const
+{
+	return mProbabilities.empty();
+}
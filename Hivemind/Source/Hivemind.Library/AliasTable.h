@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+
+class RandomStream;
+
+/**
+ * Discrete distribution compiled with Vose's alias method. Building the table from n weights costs O(n), after which
+ * every sample costs one random draw and one table lookup no matter how many outcomes there are. Rebuilding a table
+ * reuses its storage, so a table kept alive between builds stops allocating once it has seen its largest input
+ */
+class AliasTable
+{
+
+public:
+
+#pragma region Construction/Copy/Assignment
+
+	/**
+	 * Constructor. The table is empty until Build is called
+	 */
+	AliasTable();
+
+	~AliasTable() = default;
+
+	AliasTable(const AliasTable& rhs) = default;
+
+	AliasTable& operator=(const AliasTable& rhs) = default;
+
+	AliasTable(AliasTable&& rhs) = default;
+
+	AliasTable& operator=(AliasTable&& rhs) = default;
+
+#pragma endregion
+
+	/**
+	 * Compiles a set of weights into the table, replacing whatever it held before
+	 * @Param weights: One non-negative weight per outcome. Outcomes are sampled in proportion to their weight. If every
+	 * weight is zero the table is left empty
+	 */
+	void Build(const std::vector<float>& weights);
+
+	/**
+	 * Draws an outcome from the table
+	 * @Param generator: The stream the draw is taken from. Exactly one value is drawn per sample
+	 * @Return: The index of the chosen weight. The table must not be empty
+	 */
+	std::uint32_t Sample(RandomStream& generator) const;
+
+	/**
+	 * Accessor method for the number of outcomes in the table
+	 * @Return: The number of weights the table was last built from, or zero if it is empty
+	 */
+	std::uint32_t Size() const;
+
+	/**
+	 * Determines if the table has any outcome to sample
+	 * @Return: True if the table has never been built, or was last built from weights that sum to zero
+	 */
+	bool IsEmpty() const;
+
+private:
+
+	// Chance of keeping each column's own outcome rather than taking its alias
+	std::vector<float> mProbabilities;
+	std::vector<std::uint32_t> mAliases;
+
+	// Work lists for Build, kept so rebuilding does not allocate
+	std::vector<float> mScaled;
+	std::vector<std::uint32_t> mSmall;
+	std::vector<std::uint32_t> mLarge;
+
+};
@@ -4,6 +4,7 @@
 
 using namespace std;
 
+const uint32_t Bee::STATE_COUNT = 6;
 const float Bee::STANDARD_BEE_SPEED = 250.0f;
 const float Bee::BodyRadius = 12.0f;
 const float Bee::TARGET_RADIUS = 5.0f;
@@ -13,96 +14,144 @@ const sf::Color Bee::ALERT_COLOR = sf::Color::Red;
 const sf::Color Bee::STANDARD_BODY_COLOR = sf::Color(255, 204, 0);
 
 Bee::Bee(const sf::Vector2f& position, Hive& hive) :
-	Entity(position, NORMAL_COLOR, STANDARD_BODY_COLOR), mUpdate(), mParentHive(hive), mGenerator(),
-	mBody(BodyRadius), mFace(sf::Vector2f(BodyRadius, 2)), mTarget(position), mHarvestingClock(), mSpeed(STANDARD_BEE_SPEED),
-	mFoodAmount(0.0f), mHarvestingDuration(STANDARD_HARVESTING_DURATION), mMaxEnergy(10.0f), mEnergy(mMaxEnergy),
-	mEnergyConsumptionRate(0.2f), mTargeting(false), mState(State::SeekingTarget), mTargetFoodSource(nullptr)
+	Entity(position, NORMAL_COLOR, STANDARD_BODY_COLOR), mStore(BeeManager::GetInstance()->GetStore()),
+	mSlot(mStore.Allocate(this, position, hive.GetId())), mHandle(BeeManager::GetInstance()->GetHandles().Issue(this)), mParentHive(hive), mGenerator(hive.CreateBeeStream()), mDeferred(), mCollisionCell(),
+	mBodyRadius(BodyRadius), mFaceLength(BodyRadius), mHeading(0.0f), mHarvestingStartTime(World::GetInstance()->GetClock().GetElapsedTime()),
+	mHarvestingDuration(STANDARD_HARVESTING_DURATION), mMaxEnergy(10.0f), mTargeting(false), mTargetFoodSource()
 {
-	std::random_device device;
-	mGenerator = std::default_random_engine(device());
+	Speed() = STANDARD_BEE_SPEED;
+	Energy() = mMaxEnergy;
+	EnergyConsumptionRate() = 0.2f;
+	CurrentState() = State::SeekingTarget;
 
 	// Randomly offset the bee's speed by a random value
 	uniform_real_distribution<float> distribution(-50.0f, 50.0f);
-	mSpeed += distribution(mGenerator);
-	mHarvestingDuration *= (1 / (mSpeed / STANDARD_BEE_SPEED));
-
-	mBody.setPointCount(360);
-	mBody.setFillColor(mFillColor);
-	mBody.setOutlineColor(mOutlineColor);
-	mBody.setOutlineThickness(-2);
-	mFace.setFillColor(sf::Color::White);
-	mBody.setPosition(sf::Vector2f(mPosition.x - BodyRadius, mPosition.y - BodyRadius));
-	mFace.setPosition(mBody.getPosition().x, mBody.getPosition().y + BodyRadius);
-
-	mText.setFont(FontManager::GetInstance()->Hack());
-	mText.setCharacterSize(16);
-	mText.setOutlineColor(sf::Color::White);
-	mText.setFillColor(sf::Color::White);
-	stringstream ss;
-	ss << "Food: " << mFoodAmount;
-	mText.setString(ss.str());
-	mText.setPosition(mPosition - sf::Vector2f(mText.getLocalBounds().width / 2.0f, 35));
+	Speed() += distribution(mGenerator);
+	mHarvestingDuration *= (1 / (Speed() / STANDARD_BEE_SPEED));
+
 }
 
 Bee::~Bee()
 {
+	if (mCollisionNode != nullptr)
+	{
+		mCollisionNode->UnregisterBee(this);
+	}
+	mStore.Release(mSlot);
+	BeeManager::GetInstance()->GetHandles().Release(mHandle);
 }
 
-void Bee::Update(sf::RenderWindow& window, const double& deltaTime)
+void Bee::Update(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
+	// Energy has already been burned for this step by BeeStore::ConsumeEnergy
+	UNREFERENCED_PARAMETER(deltaTime);
 
-	mEnergy -= (mEnergyConsumptionRate * deltaTime);
-
-	if (mState == State::Idle || mState == State::DepositingFood)
-	{	
-		mEnergy += mParentHive.TakeFood(mMaxEnergy - mEnergy);
+	if (CurrentState() == State::Idle || CurrentState() == State::DepositingFood)
+	{
+		Defer([this]() { Energy() += mParentHive.TakeFood(mMaxEnergy - Energy()); });
 	}
-	else if (mState == State::HarvestingFood)
+	else if (CurrentState() == State::HarvestingFood)
 	{
-		mEnergy += mTargetFoodSource->TakeFood(mMaxEnergy - mEnergy);
+		auto foodSource = TargetFoodSource();
+		if (foodSource != nullptr)
+		{
+			Defer([this, foodSource]() { Energy() += foodSource->TakeFood(mMaxEnergy - Energy()); });
+		}
 	}
 	else
 	{
 		if (Hungry())
 		{
-			float requiredEnergy = mMaxEnergy - mEnergy;
-			if (mFoodAmount < requiredEnergy)
+			float requiredEnergy = mMaxEnergy - Energy();
+			if (FoodAmount() < requiredEnergy)
 			{
-				requiredEnergy = mFoodAmount;
+				requiredEnergy = FoodAmount();
 			}
-			mEnergy += requiredEnergy;
-			mFoodAmount -= requiredEnergy;
+			Energy() += requiredEnergy;
+			FoodAmount() -= requiredEnergy;
 		}
 	}
 
-	if (mEnergy <= 0.0f)
-	{
-		MarkForDelete();
-	}
+	Defer([this]()
+	{	// Energy is only final once any meal above has been served
+		if (Energy() <= 0.0f)
+		{
+			MarkForDelete();
+		}
+	});
 
-	if (mCollisionNode != nullptr && !mCollisionNode->ContainsPoint(mPosition))
+	// Collision queries for this step run around the cell the bee starts it in
+	mCollisionCell = CollisionGrid::GetInstance()->CellFromPosition(Position());
+
+	if (mCollisionNode != nullptr && mCollisionNode->GetCell() != mCollisionCell)
 	{	// If we haev a collision node and we leave it, invalidate the pointer
-		mCollisionNode->UnregisterBee(this);
+		auto previousNode = mCollisionNode;
+		Defer([this, previousNode]() { previousNode->UnregisterBee(this); });
 		mCollisionNode = nullptr;
 	}
 
 	if (mCollisionNode == nullptr)
-	{	// If the collision node is invalidated, get a new one and register to it
-		mCollisionNode = CollisionGrid::GetInstance()->CollisionNodeFromPosition(mPosition);
-		mCollisionNode->RegisterBee(this);
+	{	// Cells are allocated on demand, which mutates the grid, so the node is only looked up once updates are done
+		auto position = Position();
+		Defer([this, position]()
+		{
+			mCollisionNode = CollisionGrid::GetInstance()->CollisionNodeFromPosition(position);
+			mCollisionNode->RegisterBee(this);
+		});
 	}
 }
 
-void Bee::Render(sf::RenderWindow& window) const
+void Bee::RegisterCollisionNode()
 {
-	window.draw(mBody);
-	if (mState != State::Scouting)
+	if (mCollisionNode == nullptr)
 	{
-		window.draw(mFace);
+		mCollisionCell = CollisionGrid::GetInstance()->CellFromPosition(Position());
+		mCollisionNode = CollisionGrid::GetInstance()->CollisionNodeFromPosition(Position());
+		mCollisionNode->RegisterBee(this);
 	}
 }
 
+void Bee::Render(sf::RenderWindow& window) const
+{	// A lone bee goes through a batch of one, so it looks the same as when the colony is drawn together
+	BeeRenderer renderer;
+	AddToRenderer(renderer);
+	renderer.Render(window);
+}
+
+void Bee::UpdatePresentation()
+{
+	DetectStructureCollisions();
+
+	mHeading = atan2(Target().y - Position().y, Target().x - Position().x);
+}
+
+void Bee::AddToRenderer(BeeRenderer& renderer) const
+{
+	auto faceLength = (CurrentState() != State::Scouting) ? mFaceLength : 0.0f;
+	renderer.AddBee(Position(), mBodyRadius, mFillColor, mOutlineColor, faceLength, mHeading);
+}
+
+void Bee::AddToSnapshot(WorldSnapshot& snapshot) const
+{
+	WorldSnapshot::BeeState state;
+	state.mPosition = Position();
+	state.mTarget = Target();
+	state.mRadius = mBodyRadius;
+	state.mFaceLength = (CurrentState() != State::Scouting) ? mFaceLength : 0.0f;
+	state.mFillColor = mFillColor;
+	snapshot.AddBee(state);
+}
+
+const sf::Vector2f& Bee::GetPosition() const
+{
+	return Position();
+}
+
+void Bee::SetPosition(const sf::Vector2f& position)
+{
+	Position() = position;
+}
+
 bool Bee::HasTarget() const
 {
 	return mTargeting;
@@ -110,7 +159,7 @@ bool Bee::HasTarget() const
 
 float Bee::GetFoodAmount() const
 {
-	return mFoodAmount;
+	return FoodAmount();
 }
 
 bool Bee::CollidingWithFoodSource(const FoodSource& foodSource) const
@@ -122,16 +171,17 @@ bool Bee::CollidingWithFoodSource(const FoodSource& foodSource) const
 	auto topWall = foodPosition.y;
 	auto bottomWall = foodPosition.y + foodDimensions.y;
 	return
-		(mPosition.x + BodyRadius > leftWall) &&
-		(mPosition.x - BodyRadius < rightWall) &&
-		(mPosition.y + BodyRadius > topWall) &&
-		(mPosition.y - BodyRadius < bottomWall);
+		(Position().x + BodyRadius > leftWall) &&
+		(Position().x - BodyRadius < rightWall) &&
+		(Position().y + BodyRadius > topWall) &&
+		(Position().y - BodyRadius < bottomWall);
 }
 
 bool Bee::DetectingFoodSource(const FoodSource& foodSource) const
 {
-	auto distance = DistanceBetween(mPosition, foodSource.GetCenterTarget()) - Bee::BodyRadius;
-	return distance < FoodSource::DetectionRadius;
+	// The detection radius is measured from the edge of the bee's body
+	auto reach = FoodSource::DetectionRadius + Bee::BodyRadius;
+	return DistanceSquaredBetween(Position(), foodSource.GetCenterTarget()) < reach * reach;
 }
 
 bool Bee::CollidingWithHive(const Hive& hive) const
@@ -143,95 +193,59 @@ bool Bee::CollidingWithHive(const Hive& hive) const
 	auto topWall = foodPosition.y;
 	auto bottomWall = foodPosition.y + foodDimensions.y;
 	return
-		(mPosition.x + BodyRadius > leftWall) &&
-		(mPosition.x - BodyRadius < rightWall) &&
-		(mPosition.y + BodyRadius > topWall) &&
-		(mPosition.y - BodyRadius < bottomWall);
+		(Position().x + BodyRadius > leftWall) &&
+		(Position().x - BodyRadius < rightWall) &&
+		(Position().y + BodyRadius > topWall) &&
+		(Position().y - BodyRadius < bottomWall);
 }
 
 void Bee::SetColor(const sf::Color& color)
 {
-	mBody.setOutlineColor(color);
+	mOutlineColor = color;
 }
 
 void Bee::SetTarget(FoodSource* const foodSource)
 {
-	mTargetFoodSource = foodSource;
+	mTargetFoodSource = foodSource->GetHandle();
 	SetTarget(foodSource->GetCenterTarget());
 }
 
 void Bee::SetTarget(const sf::Vector2f& position)
 {
-	mTarget = position;
+	Target() = position;
 	mTargeting = true;
 }
 
 const sf::Vector2f& Bee::GetTarget() const
 {
-	return mTarget;
+	return Target();
 }
 
 void Bee::HandleFoodSourceCollisions()
 {
 	auto foodSourceManager = FoodSourceManager::GetInstance();
 	bool reachedCenterOfSource = false;
-	bool foodSourceFound = false;
 
-	if (!HasTarget() && mState == State::SeekingTarget)
+	if (!HasTarget() && CurrentState() == State::SeekingTarget)
 	{	// Set initial target
 		mTargeting = true;
 		std::uniform_int_distribution<int> distribution(0, foodSourceManager->GetFoodSourceCount() - 1);
 		int targetIndex = distribution(mGenerator);
-		mTargetFoodSource = &foodSourceManager->GetFoodSource(targetIndex);
-		sf::Vector2f newTarget = mTargetFoodSource->GetCenterTarget();
+		auto& foodSource = foodSourceManager->GetFoodSource(targetIndex);
+		mTargetFoodSource = foodSource.GetHandle();
+		sf::Vector2f newTarget = foodSource.GetCenterTarget();
 
 		SetTarget(newTarget);
-		mState = State::DeliveringFood;
+		CurrentState() = State::DeliveringFood;
 	}
 
-	auto foodSources = mCollisionNode->FoodSources();
-	switch (mState)
+	switch (CurrentState())
 	{
 	case State::SeekingTarget:
-		foodSourceFound = false;
-		for (auto iter = foodSources.begin(); iter != foodSources.end(); ++iter)
+		if (CollidingWithNearbyFoodSource() && Entity::DistanceBetween(GetPosition(), GetTarget()) <= Bee::TARGET_RADIUS)
 		{
-			if (CollidingWithFoodSource(*(*iter)))
-			{
-				foodSourceFound = true;
-				if (Entity::DistanceBetween(GetPosition(), GetTarget()) <= Bee::TARGET_RADIUS)
-				{
-					reachedCenterOfSource = true;
-					mState = State::HarvestingFood;
-					break;
-				}
-			}
-		}
-
-		if (!foodSourceFound)
-		{
-			auto neighbors = CollisionGrid::GetInstance()->NeighborsOf(mCollisionNode);
-			for (uint32_t i = 0; i < neighbors.size(); i++)
-			{
-				vector<FoodSource*> neighborFoodSources = neighbors[i]->FoodSources();
-				for (auto iter = neighborFoodSources.begin(); iter != neighborFoodSources.end(); ++iter)
-				{
-					if (CollidingWithFoodSource(*(*iter)))
-					{
-						foodSourceFound = true;
-						if (Entity::DistanceBetween(GetPosition(), GetTarget()) <= Bee::TARGET_RADIUS)
-						{
-							reachedCenterOfSource = true;
-							mState = State::HarvestingFood;
-							break;
-						}
-					}
-				}
-				if (foodSourceFound)
-				{	// Early out so we know the others don't matter
-					break;
-				}
-			}
+			reachedCenterOfSource = true;
+			CurrentState() = State::HarvestingFood;
 		}
 		break;
 	default:;
@@ -239,8 +253,8 @@ void Bee::HandleFoodSourceCollisions()
 
 	if (reachedCenterOfSource)
 	{
-		mState = State::HarvestingFood;
-		mHarvestingClock.restart();
+		CurrentState() = State::HarvestingFood;
+		RestartHarvestingTimer();
 	}
 }
 
@@ -248,77 +262,180 @@ void Bee::DetectStructureCollisions()
 {
 
 	bool colliding = false;
-	auto hives = mCollisionNode->Hives();
-	for (auto iter = hives.begin(); iter != hives.end(); ++iter)
+	auto node = CollisionGrid::GetInstance()->FindCollisionNode(mCollisionCell);
+	if (node != nullptr)
 	{
-		if (CollidingWithHive(*(*iter)))
+		auto& hives = node->Hives();
+		for (auto iter = hives.begin(); iter != hives.end(); ++iter)
 		{
-			colliding = true;
-			break;
+			if (CollidingWithHive(*(*iter)))
+			{
+				colliding = true;
+				break;
+			}
 		}
 	}
 
-	auto foodSources = mCollisionNode->FoodSources();
-	for (auto iter = foodSources.begin(); iter != foodSources.end(); ++iter)
+	if (!colliding)
 	{
-		if (CollidingWithFoodSource(*(*iter)))
-		{
-			colliding = true;
-			break;
-		}
+		colliding = CollidingWithNearbyFoodSource();
 	}
-	if (!colliding)
+
+	SetColor(colliding ? Bee::ALERT_COLOR : Bee::NORMAL_COLOR);
+}
+
+bool Bee::CollidingWithNearbyFoodSource() const
+{
+	return CollisionGrid::GetInstance()->QueryAround(mCollisionCell, [this](const CollisionNode& node)
 	{
-		auto neighbors = CollisionGrid::GetInstance()->NeighborsOf(mCollisionNode);
-		for (auto iter = neighbors.begin(); iter != neighbors.end(); ++iter)
+		auto& foodSources = node.FoodSources();
+		for (auto iter = foodSources.begin(); iter != foodSources.end(); ++iter)
 		{
-			auto neighborFoodSources = (*iter)->FoodSources();
-			for (auto it = neighborFoodSources.begin(); it != neighborFoodSources.end(); ++it)
+			if (CollidingWithFoodSource(*(*iter)))
 			{
-				if (CollidingWithFoodSource(*(*it)))
-				{
-					colliding = true;
-					break;
-				}
+				return true;
 			}
 		}
-	}
+		return false;
+	});
+}
 
-	SetColor(colliding ? Bee::ALERT_COLOR : Bee::NORMAL_COLOR);
+void Bee::RestartHarvestingTimer()
+{
+	mHarvestingStartTime = World::GetInstance()->GetClock().GetElapsedTime();
+}
+
+double Bee::HarvestingTimeElapsed() const
+{
+	return World::GetInstance()->GetClock().GetElapsedTime() - mHarvestingStartTime;
+}
+
+void Bee::Defer(const function<void()>& mutation)
+{
+	mDeferred.push_back(mutation);
+}
+
+void Bee::CommitDeferred()
+{
+	for (auto iter = mDeferred.begin(); iter != mDeferred.end(); ++iter)
+	{
+		(*iter)();
+	}
+	mDeferred.clear();
 }
 
 void Bee::HarvestFood(const float& foodAmount)
 {
-	mFoodAmount += foodAmount;
+	FoodAmount() += foodAmount;
 }
 
 void Bee::DepositFood(float foodAmount)
 {
-	if (foodAmount > mFoodAmount)
+	if (foodAmount > FoodAmount())
 	{	// Cap the food deposit to whatever the maximum is that the bee currently holds
-		foodAmount = mFoodAmount;
+		foodAmount = FoodAmount();
 	}
 	mParentHive.DepositFood(foodAmount);
-	mFoodAmount -= foodAmount;
+	FoodAmount() -= foodAmount;
 }
 
 void Bee::SetState(const State& state)
 {
-	mState = state;
+	CurrentState() = state;
 }
 
 Bee::State Bee::GetState() const
 {
-	return mState;
+	return CurrentState();
 }
 
 bool Bee::Hungry() const
 {
 	// Hungry if less than 50% energy
-	return mEnergy / mMaxEnergy < 0.50f;
+	return Energy() / mMaxEnergy < 0.50f;
 }
 
 Hive& Bee::GetParentHive() const
 {
 	return mParentHive;
 }
+
+const Handle<Bee>& Bee::GetHandle() const
+{
+	return mHandle;
+}
+
+FoodSource* Bee::TargetFoodSource() const
+{
+	return FoodSourceManager::GetInstance()->FindFoodSource(mTargetFoodSource);
+}
+
+sf::Vector2f& Bee::Position()
+{
+	return mStore.Position(mSlot);
+}
+
+const sf::Vector2f& Bee::Position() const
+{
+	return mStore.Position(mSlot);
+}
+
+sf::Vector2f& Bee::Target()
+{
+	return mStore.Target(mSlot);
+}
+
+const sf::Vector2f& Bee::Target() const
+{
+	return mStore.Target(mSlot);
+}
+
+float& Bee::Speed()
+{
+	return mStore.Speed(mSlot);
+}
+
+float Bee::Speed() const
+{
+	return mStore.Speed(mSlot);
+}
+
+float& Bee::Energy()
+{
+	return mStore.Energy(mSlot);
+}
+
+float Bee::Energy() const
+{
+	return mStore.Energy(mSlot);
+}
+
+float& Bee::EnergyConsumptionRate()
+{
+	return mStore.EnergyConsumptionRate(mSlot);
+}
+
+float Bee::EnergyConsumptionRate() const
+{
+	return mStore.EnergyConsumptionRate(mSlot);
+}
+
+float& Bee::FoodAmount()
+{
+	return mStore.FoodAmount(mSlot);
+}
+
+float Bee::FoodAmount() const
+{
+	return mStore.FoodAmount(mSlot);
+}
+
+Bee::State& Bee::CurrentState()
+{
+	return mStore.State(mSlot);
+}
+
+Bee::State Bee::CurrentState() const
+{
+	return mStore.State(mSlot);
+}
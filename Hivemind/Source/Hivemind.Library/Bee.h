@@ -3,9 +3,15 @@
 #include <random>
 #include <map>
 #include <functional>
+#include "RandomStream.h"
+#include "Handle.h"
 
 
 class Hive;
+class BeeStore;
+class FoodSource;
+class BeeRenderer;
+class WorldSnapshot;
 
 class Bee : public Entity
 {
@@ -21,7 +27,7 @@ public:
 		Larva
 	};
 
-	enum State
+	enum State : std::uint8_t
 	{
 		Idle,
 		Scouting,
@@ -31,13 +37,14 @@ public:
 		DepositingFood,
 	};
 
+	const static std::uint32_t STATE_COUNT;
 	const static float STANDARD_BEE_SPEED;
 	const static float BodyRadius;
 	const static float TARGET_RADIUS;
 	const static float STANDARD_HARVESTING_DURATION;
 	const static sf::Color NORMAL_COLOR;
 	const static sf::Color ALERT_COLOR;
-	const static sf::Color Bee::STANDARD_BODY_COLOR;
+	const static sf::Color STANDARD_BODY_COLOR;
 
 #pragma region Construction/Copy/Assignment
 
@@ -62,10 +69,9 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 * Render method called by the main game loop
@@ -73,6 +79,35 @@ public:
 	 */
 	void Render(sf::RenderWindow& window) const override;
 
+	/**
+	 * Turns the face toward the bee's target and colors the outline if the bee overlaps a hive or food source
+	 */
+	void UpdatePresentation() override;
+
+	/**
+	 * Adds the bee's body and face to a batch, so the manager can draw the whole colony at once
+	 * @Param renderer: The batch being built for this frame
+	 */
+	void AddToRenderer(BeeRenderer& renderer) const;
+
+	/**
+	 * Copies the bee's position, target and look into a snapshot of the world, without refreshing any presentation
+	 * @Param snapshot: The snapshot being captured, whose current cell is the one the bee is registered in
+	 */
+	void AddToSnapshot(WorldSnapshot& snapshot) const;
+
+	/**
+	 * Accessor method for the bee's position, which lives in the BeeManager's hot storage
+	 * @Return: The bee's position
+	 */
+	const sf::Vector2f& GetPosition() const override;
+
+	/**
+	 * Mutator method for the bee's position
+	 * @Param position: The position that the bee is being moved to
+	 */
+	void SetPosition(const sf::Vector2f& position) override;
+
 	/**
 	 * Determines if the bee is colliding with the specified food source
 	 * @Param foodSource: The food source being checked
@@ -166,17 +201,48 @@ public:
 	 */
 	Hive& GetParentHive() const;
 
-protected:
+	/**
+	 * Accessor method for the handle the BeeManager issued for this bee
+	 * @Return: A handle that resolves to this bee until it is destroyed
+	 */
+	const Handle<Bee>& GetHandle() const;
+
+	/**
+	 * Applies every change to shared state that was deferred during the last Update, in the order it was requested.
+	 * Called serially by the BeeManager once every bee has finished its Update
+	 */
+	void CommitDeferred();
 
 	/**
-	 * Method children must do to populate their function maps (if used)
-	 * //TODO: Move function map and methods to a component
+	 * Registers the bee with the collision node under it straight away, rather than at the end of its first Update.
+	 * Called serially by the BeeManager as the bee is spawned, so the render pass finds it from its first frame
 	 */
-	virtual void PopulateFunctionMaps() = 0;
+	void RegisterCollisionNode();
+
+protected:
+
+	friend class BeeStore;
+
+#pragma region Hot Data
+
+	// Per-tick state is kept in the BeeManager's BeeStore, indexed by this bee's slot
+	sf::Vector2f& Position();
+	const sf::Vector2f& Position() const;
+	sf::Vector2f& Target();
+	const sf::Vector2f& Target() const;
+	float& Speed();
+	float Speed() const;
+	float& Energy();
+	float Energy() const;
+	float& EnergyConsumptionRate();
+	float EnergyConsumptionRate() const;
+	float& FoodAmount();
+	float FoodAmount() const;
+	State& CurrentState();
+	State CurrentState() const;
+
+#pragma endregion
 
-	typedef std::function<void(sf::RenderWindow&, const double&)> UpdateCallback;
-	std::map<State, UpdateCallback> mUpdate;
-	
 	// Constants
 	const float PI = 3.14159265359f;
 	const float EXTRACTION_YIELD = 5.0f;
@@ -185,22 +251,51 @@ protected:
 	void HandleFoodSourceCollisions();
 	void DetectStructureCollisions();
 
+	/**
+	 * Determines if the bee is colliding with any food source registered in or around its collision cell
+	 * @Return: True if a food source in the 3x3 block of cells around the bee overlaps it. False otherwise
+	 */
+	bool CollidingWithNearbyFoodSource() const;
+
+	/**
+	 * Resolves the handle of the food source the bee is headed for
+	 * @Return: The targeted food source, or nullptr if there is none
+	 */
+	FoodSource* TargetFoodSource() const;
+
+	/**
+	 * Starts timing a harvest or deposit from the current simulation time
+	 */
+	void RestartHarvestingTimer();
+
+	/**
+	 * Determines how long the current harvest or deposit has been running
+	 * @Return: The simulation time, in seconds, since the harvesting timer was last restarted
+	 */
+	double HarvestingTimeElapsed() const;
+
+	/**
+	 * Queues a change to state shared with other entities (hives, food sources, the collision grid or the bee lists)
+	 * until the commit phase. Updates run concurrently with other bees, so they may only read shared state
+	 * @Param mutation: The change to apply once every bee has finished its Update
+	 */
+	void Defer(const std::function<void()>& mutation);
+
 	// Private fields
+	BeeStore& mStore;
+	std::uint32_t mSlot;
+	Handle<Bee> mHandle;
 	Hive& mParentHive;
-	std::default_random_engine mGenerator;
-	sf::CircleShape mBody;
-	sf::RectangleShape mFace;
-	sf::Vector2f mTarget;
-	sf::Text mText;
-	sf::Clock mHarvestingClock;
-	float mSpeed;
-	float mFoodAmount;
+	RandomStream mGenerator;
+	std::vector<std::function<void()>> mDeferred;
+	sf::Vector2i mCollisionCell;
+	float mBodyRadius;
+	float mFaceLength;
+	float mHeading;
+	double mHarvestingStartTime;
 	float mHarvestingDuration;
 	float mMaxEnergy;
-	float mEnergy;
-	float mEnergyConsumptionRate;
 	bool mTargeting;
-	State mState;
-	class FoodSource* mTargetFoodSource;
+	Handle<FoodSource> mTargetFoodSource;
 
 };
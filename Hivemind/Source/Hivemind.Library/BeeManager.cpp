@@ -5,7 +5,9 @@
 BeeManager* BeeManager::sInstance = nullptr;
 
 BeeManager::BeeManager() :
-	mOnlookers(), mEmployees(), mTimeSinceRetarget(0.0f), generator()
+	mStore(), mHandles(BeeStore::INITIAL_CAPACITY), mOnlookerPool(), mEmployeePool(), mQueenPool(), mDronePool(), mGuardPool(), mLarvaPool(),
+	mOnlookers(), mEmployees(), mUpdateOrder(),
+	mOnlookerBuckets(Bee::STATE_COUNT), mEmployeeBuckets(Bee::STATE_COUNT), mCommands(), mTimeSinceRetarget(0.0f)
 {
 }
 
@@ -22,27 +24,27 @@ BeeManager::~BeeManager()
 {
 	for (auto iter = mOnlookers.begin(); iter != mOnlookers.end(); ++iter)
 	{
-		delete (*iter);
+		mOnlookerPool.Destroy(*iter);
 	}
 	for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
 	{
-		delete (*iter);
+		mEmployeePool.Destroy(*iter);
 	}
 	for (auto iter = mQueens.begin(); iter != mQueens.end(); ++iter)
 	{
-		delete (*iter);
+		mQueenPool.Destroy(*iter);
 	}
 	for (auto iter = mDrones.begin(); iter != mDrones.end(); ++iter)
 	{
-		delete (*iter);
+		mDronePool.Destroy(*iter);
 	}
 	for (auto iter = mGuards.begin(); iter != mGuards.end(); ++iter)
 	{
-		delete (*iter);
+		mGuardPool.Destroy(*iter);
 	}
 	for (auto iter = mLarva.begin(); iter != mLarva.end(); ++iter)
 	{
-		delete (*iter);
+		mLarvaPool.Destroy(*iter);
 	}
 	mOnlookers.clear();
 	mEmployees.clear();
@@ -54,93 +56,162 @@ BeeManager::~BeeManager()
 
 void BeeManager::SpawnOnlooker(const sf::Vector2f& position, Hive& hive)
 {
-	mOnlookers.push_back(new OnlookerBee(position, hive));
+	mOnlookers.push_back(mOnlookerPool.Create(position, hive));
+	mOnlookers.back()->RegisterCollisionNode();
 	hive.IncrementBeeCount(Hive::BeeType::Onlooker);
 }
 
 void BeeManager::SpawnEmployee(const sf::Vector2f& position, Hive& hive)
 {
-	mEmployees.push_back(new EmployedBee(position, hive));
+	mEmployees.push_back(mEmployeePool.Create(position, hive));
+	mEmployees.back()->RegisterCollisionNode();
 	hive.IncrementBeeCount(Hive::BeeType::Employee);
 }
 
 void BeeManager::SpawnQueen(const sf::Vector2f& position, Hive& hive)
 {
-	mQueens.push_back(new QueenBee(position, hive));
+	mQueens.push_back(mQueenPool.Create(position, hive));
+	mQueens.back()->RegisterCollisionNode();
 	hive.IncrementBeeCount(Hive::BeeType::Queen);
 }
 
 void BeeManager::SpawnDrone(const sf::Vector2f& position, Hive& hive)
 {
-	mDrones.push_back(new Drone(position, hive));
+	mDrones.push_back(mDronePool.Create(position, hive));
+	mDrones.back()->RegisterCollisionNode();
 	hive.IncrementBeeCount(Hive::BeeType::Drone);
 }
 
 void BeeManager::SpawnGuard(const sf::Vector2f& position, Hive& hive)
 {
-	mGuards.push_back(new Guard(position, hive));
+	mGuards.push_back(mGuardPool.Create(position, hive));
+	mGuards.back()->RegisterCollisionNode();
 	hive.IncrementBeeCount(Hive::BeeType::Guard);
 }
 
 void BeeManager::SpawnLarva(const sf::Vector2f& position, Hive& hive, const Larva::LarvaType& larvaType)
 {
-	mLarva.push_back(new Larva(position, hive, larvaType));
+	mLarva.push_back(mLarvaPool.Create(position, hive, larvaType));
+	mLarva.back()->RegisterCollisionNode();
 }
 
-void BeeManager::Update(sf::RenderWindow& window, const float& deltaTime)
+template <typename T, typename Kernel>
+void BeeManager::RunKernel(ThreadPool& pool, std::vector<T*>& bucket, const Kernel& kernel)
 {
-	for (auto iter = mOnlookers.begin(); iter != mOnlookers.end(); ++iter)
-	{
-		(*iter)->Update(window, deltaTime);
-	}
-	for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
+	pool.ParallelForRange(static_cast<std::uint32_t>(bucket.size()), [&bucket, &kernel](std::uint32_t begin, std::uint32_t end)
 	{
-		(*iter)->Update(window, deltaTime);
-	}
-	for (auto iter = mQueens.begin(); iter != mQueens.end(); ++iter)
-	{
-		(*iter)->Update(window, deltaTime);
-	}
-	for (auto iter = mDrones.begin(); iter != mDrones.end(); ++iter)
-	{
-		(*iter)->Update(window, deltaTime);
-	}
-	for (auto iter = mGuards.begin(); iter != mGuards.end(); ++iter)
-	{
-		(*iter)->Update(window, deltaTime);
-	}
-	for (auto iter = mLarva.begin(); iter != mLarva.end(); ++iter)
+		for (auto i = begin; i < end; ++i)
+		{
+			kernel(bucket[i]);
+		}
+	});
+}
+
+void BeeManager::Update(const float& deltaTime)
+{
+	// Snapshot the bees alive at the start of the step. Anything spawned during the commit waits for the next one
+	mUpdateOrder.clear();
+	mUpdateOrder.insert(mUpdateOrder.end(), mOnlookers.begin(), mOnlookers.end());
+	mUpdateOrder.insert(mUpdateOrder.end(), mEmployees.begin(), mEmployees.end());
+	mUpdateOrder.insert(mUpdateOrder.end(), mQueens.begin(), mQueens.end());
+	mUpdateOrder.insert(mUpdateOrder.end(), mDrones.begin(), mDrones.end());
+	mUpdateOrder.insert(mUpdateOrder.end(), mGuards.begin(), mGuards.end());
+	mUpdateOrder.insert(mUpdateOrder.end(), mLarva.begin(), mLarva.end());
+
+	// Stream through the hot arrays before touching any bee objects
+	mStore.ConsumeEnergy(deltaTime);
+
+	// Sense and decide, one loop per bee type and state. Each bee only writes to itself and reads everything else.
+	// Bees that change state land in their new bucket on the next step
+	SortIntoBuckets();
+	double stepTime = deltaTime;
+	auto& pool = World::GetInstance()->GetThreadPool();
+
+	RunKernel(pool, mOnlookerBuckets[Bee::State::Idle], [stepTime](OnlookerBee* bee) { bee->StepIdle(stepTime); });
+	RunKernel(pool, mOnlookerBuckets[Bee::State::SeekingTarget], [stepTime](OnlookerBee* bee) { bee->StepSeekingTarget(stepTime); });
+	RunKernel(pool, mOnlookerBuckets[Bee::State::HarvestingFood], [stepTime](OnlookerBee* bee) { bee->StepHarvestingFood(stepTime); });
+	RunKernel(pool, mOnlookerBuckets[Bee::State::DeliveringFood], [stepTime](OnlookerBee* bee) { bee->StepDeliveringFood(stepTime); });
+	RunKernel(pool, mOnlookerBuckets[Bee::State::DepositingFood], [stepTime](OnlookerBee* bee) { bee->StepDepositingFood(stepTime); });
+
+	RunKernel(pool, mEmployeeBuckets[Bee::State::Scouting], [stepTime](EmployedBee* bee) { bee->StepScouting(stepTime); });
+	RunKernel(pool, mEmployeeBuckets[Bee::State::SeekingTarget], [stepTime](EmployedBee* bee) { bee->StepSeekingTarget(stepTime); });
+	RunKernel(pool, mEmployeeBuckets[Bee::State::HarvestingFood], [stepTime](EmployedBee* bee) { bee->StepHarvestingFood(stepTime); });
+	RunKernel(pool, mEmployeeBuckets[Bee::State::DeliveringFood], [stepTime](EmployedBee* bee) { bee->StepDeliveringFood(stepTime); });
+	RunKernel(pool, mEmployeeBuckets[Bee::State::DepositingFood], [stepTime](EmployedBee* bee) { bee->StepDepositingFood(stepTime); });
+
+	RunKernel(pool, mQueens, [stepTime](QueenBee* bee) { bee->QueenBee::Update(stepTime); });
+	RunKernel(pool, mDrones, [stepTime](Drone* bee) { bee->Drone::Update(stepTime); });
+	RunKernel(pool, mGuards, [stepTime](Guard* bee) { bee->Guard::Update(stepTime); });
+	RunKernel(pool, mLarva, [stepTime](Larva* bee) { bee->Larva::Update(stepTime); });
+
+	// Commit in a fixed order so the outcome does not depend on the thread count
+	for (auto iter = mUpdateOrder.begin(); iter != mUpdateOrder.end(); ++iter)
 	{
-		(*iter)->Update(window, deltaTime);
+		(*iter)->CommitDeferred();
 	}
+
 	CleanupBees();
 }
 
-void BeeManager::Render(sf::RenderWindow& window)
+void BeeManager::FlushCommands()
 {
-	for (auto iter = mOnlookers.begin(); iter != mOnlookers.end(); ++iter)
-	{
-		(*iter)->Render(window);
-	}
-	for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
-	{
-		(*iter)->Render(window);
-	}
-	for (auto iter = mQueens.begin(); iter != mQueens.end(); ++iter)
+	// Grow each list once for the whole batch rather than once per spawn
+	mOnlookers.reserve(mOnlookers.size() + mCommands.Count(Bee::Type::Onlooker));
+	mEmployees.reserve(mEmployees.size() + mCommands.Count(Bee::Type::Employee));
+	mQueens.reserve(mQueens.size() + mCommands.Count(Bee::Type::Queen));
+	mDrones.reserve(mDrones.size() + mCommands.Count(Bee::Type::Drone));
+	mGuards.reserve(mGuards.size() + mCommands.Count(Bee::Type::Guard));
+	mLarva.reserve(mLarva.size() + mCommands.Count(Bee::Type::Larva));
+
+	for (auto iter = mCommands.Begin(); iter != mCommands.End(); ++iter)
 	{
-		(*iter)->Render(window);
+		switch (iter->mBeeType)
+		{
+		case Bee::Type::Onlooker:
+			SpawnOnlooker(iter->mPosition, *iter->mHive);
+			break;
+		case Bee::Type::Employee:
+			SpawnEmployee(iter->mPosition, *iter->mHive);
+			break;
+		case Bee::Type::Queen:
+			SpawnQueen(iter->mPosition, *iter->mHive);
+			break;
+		case Bee::Type::Drone:
+			SpawnDrone(iter->mPosition, *iter->mHive);
+			break;
+		case Bee::Type::Guard:
+			SpawnGuard(iter->mPosition, *iter->mHive);
+			break;
+		case Bee::Type::Larva:
+			SpawnLarva(iter->mPosition, *iter->mHive, iter->mLarvaType);
+			break;
+		}
 	}
-	for (auto iter = mDrones.begin(); iter != mDrones.end(); ++iter)
+	mCommands.Clear();
+}
+
+CommandBuffer& BeeManager::GetCommands()
+{
+	return mCommands;
+}
+
+void BeeManager::SortIntoBuckets()
+{
+	for (std::uint32_t i = 0; i < Bee::STATE_COUNT; ++i)
 	{
-		(*iter)->Render(window);
+		mOnlookerBuckets[i].clear();
+		mEmployeeBuckets[i].clear();
 	}
-	for (auto iter = mGuards.begin(); iter != mGuards.end(); ++iter)
+
+	for (auto iter = mOnlookers.begin(); iter != mOnlookers.end(); ++iter)
 	{
-		(*iter)->Render(window);
+		assert((*iter)->GetState() != Bee::State::Scouting);
+		mOnlookerBuckets[(*iter)->GetState()].push_back(*iter);
 	}
-	for (auto iter = mLarva.begin(); iter != mLarva.end(); ++iter)
+	for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
 	{
-		(*iter)->Render(window);
+		assert((*iter)->GetState() != Bee::State::Idle);
+		mEmployeeBuckets[(*iter)->GetState()].push_back(*iter);
 	}
 }
 
@@ -234,147 +305,145 @@ std::uint32_t BeeManager::LarvaCount() const
 	return static_cast<std::uint32_t>(mLarva.size());
 }
 
-void BeeManager::ToggleEmployeeFlowFields()
+std::uint32_t BeeManager::BeeCount() const
 {
-	for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
-	{
-		(*iter)->ToggleFlowField();
-	}
+	return OnlookerCount() + EmployeeCount() + QueenCount() + DroneCount() + GuardCount() + LarvaCount();
 }
 
-void BeeManager::SetEmployeeFlowFieldOctaveCount(const std::uint32_t& octaveCount)
+const PoolStatistics& BeeManager::GetPoolStatistics(const Bee::Type& type) const
 {
-	for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
+	switch (type)
 	{
-		(*iter)->SetFlowFieldOctaveCount(octaveCount);
+	case Bee::Type::Onlooker:
+		return mOnlookerPool.GetStatistics();
+	case Bee::Type::Employee:
+		return mEmployeePool.GetStatistics();
+	case Bee::Type::Queen:
+		return mQueenPool.GetStatistics();
+	case Bee::Type::Drone:
+		return mDronePool.GetStatistics();
+	case Bee::Type::Guard:
+		return mGuardPool.GetStatistics();
+	default:
+		return mLarvaPool.GetStatistics();
 	}
 }
 
-void BeeManager::CleanupBees()
+BeeStore& BeeManager::GetStore()
+{
+	return mStore;
+}
+
+HandleTable<Bee>& BeeManager::GetHandles()
 {
-	CleanupOnlookers();
-	CleanupEmployees();
-	CleanupQueens();
-	CleanupDrones();
-	CleanupGuards();
-	CleanupLarva();
+	return mHandles;
 }
 
-void BeeManager::CleanupOnlookers()
+Bee* BeeManager::FindBee(const Handle<Bee>& handle) const
 {
-	bool onlookerRemoved = true;
-	while (onlookerRemoved)
+	return mHandles.Find(handle);
+}
+
+void BeeManager::ToggleEmployeeFlowFields()
+{
+	for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
 	{
-		onlookerRemoved = false;
-		for (auto iter = mOnlookers.begin(); iter != mOnlookers.end(); ++iter)
-		{
-			if ((*iter)->MarkedForDelete())
-			{
-				(*iter)->GetParentHive().DecrementBeeCount(Hive::BeeType::Onlooker);
-				delete *iter;
-				mOnlookers.erase(iter);
-				onlookerRemoved = true;
-				break;
-			}
-		}
+		(*iter)->ToggleFlowField();
 	}
 }
 
-void BeeManager::CleanupEmployees()
+void BeeManager::SetEmployeeFlowFieldOctaveCount(const std::uint32_t& octaveCount)
 {
-	bool employeeRemoved = true;
-	while (employeeRemoved)
+	for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
 	{
-		employeeRemoved = false;
-		for (auto iter = mEmployees.begin(); iter != mEmployees.end(); ++iter)
-		{
-			if ((*iter)->MarkedForDelete())
-			{
-				(*iter)->GetParentHive().DecrementBeeCount(Hive::BeeType::Employee);
-				delete *iter;
-				mEmployees.erase(iter);
-				employeeRemoved = true;
-				break;
-			}
-		}
+		(*iter)->SetFlowFieldOctaveCount(octaveCount);
 	}
 }
 
-void BeeManager::CleanupQueens()
+void BeeManager::CleanupBees()
 {
-	bool queenRemoved = true;
-	while (queenRemoved)
+	CompactBees(mOnlookers, Bee::Type::Onlooker, true);
+	SettleDeathTally(Hive::BeeType::Onlooker);
+	CompactBees(mEmployees, Bee::Type::Employee, true);
+	SettleDeathTally(Hive::BeeType::Employee);
+	CompactBees(mQueens, Bee::Type::Queen, true);
+	SettleDeathTally(Hive::BeeType::Queen);
+	CompactBees(mDrones, Bee::Type::Drone, true);
+	SettleDeathTally(Hive::BeeType::Drone);
+	CompactBees(mGuards, Bee::Type::Guard, true);
+	SettleDeathTally(Hive::BeeType::Guard);
+	CompactBees(mLarva, Bee::Type::Larva, false);
+
+	// Destruction waits until every list is compacted, so no list ever holds a destroyed bee
+	for (auto iter = mGraveyard.begin(); iter != mGraveyard.end(); ++iter)
 	{
-		queenRemoved = false;
-		for (auto iter = mQueens.begin(); iter != mQueens.end(); ++iter)
-		{
-			if ((*iter)->MarkedForDelete())
-			{
-				(*iter)->GetParentHive().DecrementBeeCount(Hive::BeeType::Queen);
-				delete *iter;
-				mQueens.erase(iter);
-				queenRemoved = true;
-				break;
-			}
-		}
+		DestroyBee(iter->first, iter->second);
 	}
+	mGraveyard.clear();
 }
 
-void BeeManager::CleanupDrones()
+template <typename T>
+void BeeManager::CompactBees(std::vector<T*>& bees, const Bee::Type& type, const bool& tallyDeaths)
 {
-	bool droneRemoved = true;
-	while (droneRemoved)
+	auto survivor = bees.begin();
+	for (auto iter = bees.begin(); iter != bees.end(); ++iter)
 	{
-		droneRemoved = false;
-		for (auto iter = mDrones.begin(); iter != mDrones.end(); ++iter)
+		if ((*iter)->MarkedForDelete())
 		{
-			if ((*iter)->MarkedForDelete())
+			if (tallyDeaths)
 			{
-				(*iter)->GetParentHive().DecrementBeeCount(Hive::BeeType::Drone);
-				delete *iter;
-				mDrones.erase(iter);
-				droneRemoved = true;
-				break;
+				auto& hive = (*iter)->GetParentHive();
+				if (hive.GetId() >= mDeathTally.size())
+				{
+					mDeathTally.resize(hive.GetId() + 1, std::make_pair(nullptr, 0));
+				}
+				mDeathTally[hive.GetId()].first = &hive;
+				mDeathTally[hive.GetId()].second++;
 			}
+			mGraveyard.push_back(std::make_pair(*iter, type));
+		}
+		else
+		{
+			*survivor = *iter;
+			++survivor;
 		}
 	}
+	bees.erase(survivor, bees.end());
 }
 
-void BeeManager::CleanupGuards()
+void BeeManager::SettleDeathTally(const Hive::BeeType& type)
 {
-	bool guardRemoved = true;
-	while (guardRemoved)
+	for (auto iter = mDeathTally.begin(); iter != mDeathTally.end(); ++iter)
 	{
-		guardRemoved = false;
-		for (auto iter = mGuards.begin(); iter != mGuards.end(); ++iter)
+		if (iter->second > 0)
 		{
-			if ((*iter)->MarkedForDelete())
-			{
-				(*iter)->GetParentHive().DecrementBeeCount(Hive::BeeType::Guard);
-				delete *iter;
-				mGuards.erase(iter);
-				guardRemoved = true;
-				break;
-			}
+			iter->first->DecrementBeeCount(type, iter->second);
+			iter->second = 0;
 		}
 	}
 }
 
-void BeeManager::CleanupLarva()
+void BeeManager::DestroyBee(Bee* const bee, const Bee::Type& type)
 {
-	bool larvaRemoved = true;
-	while (larvaRemoved)
+	switch (type)
 	{
-		larvaRemoved = false;
-		for (auto iter = mLarva.begin(); iter != mLarva.end(); ++iter)
-		{
-			if ((*iter)->MarkedForDelete())
-			{
-				delete *iter;
-				mLarva.erase(iter);
-				larvaRemoved = true;
-				break;
-			}
-		}
+	case Bee::Type::Onlooker:
+		mOnlookerPool.Destroy(static_cast<OnlookerBee*>(bee));
+		break;
+	case Bee::Type::Employee:
+		mEmployeePool.Destroy(static_cast<EmployedBee*>(bee));
+		break;
+	case Bee::Type::Queen:
+		mQueenPool.Destroy(static_cast<QueenBee*>(bee));
+		break;
+	case Bee::Type::Drone:
+		mDronePool.Destroy(static_cast<Drone*>(bee));
+		break;
+	case Bee::Type::Guard:
+		mGuardPool.Destroy(static_cast<Guard*>(bee));
+		break;
+	case Bee::Type::Larva:
+		mLarvaPool.Destroy(static_cast<Larva*>(bee));
+		break;
 	}
 }
@@ -1,8 +1,18 @@
 #pragma once
 #include "Bee.h"
 #include "Larva.h"
+#include "BeeStore.h"
+#include "Hive.h"
+#include "EmployedBee.h"
+#include "QueenBee.h"
+#include "Drone.h"
+#include "Guard.h"
+#include "ObjectPool.h"
+#include "CommandBuffer.h"
 
 
+class ThreadPool;
+
 class BeeManager
 {
 public:
@@ -76,17 +86,23 @@ public:
 	void SpawnLarva(const sf::Vector2f& position, Hive& hive, const Larva::LarvaType& larvaType);
 
 	/**
-	 * Disseminates update calls to all bees in the simulation
-	 * @Param window: The window that the bees are being displayed to
+	 * Disseminates update calls to all bees in the simulation. Bees update in parallel on the world's thread pool,
+	 * then their deferred changes to shared state are committed one bee at a time in a fixed order
 	 * @Param DeltaTime: The time since last update was called
 	 */
-	void Update(sf::RenderWindow& window, const float& deltaTime);
+	void Update(const float& deltaTime);
+
+	/**
+	 * Applies every spawn recorded in the command buffer since the last flush, in the order it was recorded.
+	 * Called by the World once every system has finished its step, so no bee list grows while it is being iterated
+	 */
+	void FlushCommands();
 
 	/**
-	 * Disseminates render callst o all the bees in the simulation
-	 * @Param window: The window tha tthe bees are being displayed to
+	 * Accessor method for the buffer that holds spawns until the end of the step
+	 * @Return: A reference to the bee manager's command buffer
 	 */
-	void Render(sf::RenderWindow& window);
+	CommandBuffer& GetCommands();
 
 	/**
 	 * Accessor method for the begin iterator of the onlooker bees collection
@@ -196,6 +212,38 @@ public:
 	 */
 	std::uint32_t LarvaCount() const;
 
+	/**
+	 * Accessor method for the number of bees of every type
+	 * @Return: The total number of living bees in the simulation
+	 */
+	std::uint32_t BeeCount() const;
+
+	/**
+	 * Accessor method for the allocation counters of a bee type's pool
+	 * @Param type: The type of bee whose pool is being inspected
+	 * @Return: The capacity, live count, high-water mark and recycle counts of the pool
+	 */
+	const PoolStatistics& GetPoolStatistics(const Bee::Type& type) const;
+
+	/**
+	 * Accessor method for the contiguous per-tick data of every bee
+	 * @Return: A reference to the bee store
+	 */
+	BeeStore& GetStore();
+
+	/**
+	 * Accessor method for the table that issues every bee's handle
+	 * @Return: A reference to the bee handle table
+	 */
+	HandleTable<Bee>& GetHandles();
+
+	/**
+	 * Resolves a handle issued to a bee
+	 * @Param handle: The handle of the bee being looked up
+	 * @Return: A pointer to the bee, or nullptr if the handle is null or the bee has been destroyed
+	 */
+	Bee* FindBee(const Handle<Bee>& handle) const;
+
 	/**
 	 *  Toggles the flow field visualization for all employed bees
 	 */
@@ -210,50 +258,70 @@ public:
 private:
 
 	/**
-	 * Removes all bees marked for delete
-	 */
-	void CleanupBees();
-
-	/**
-	 * Removes all onlookers marked for delete
+	 * Sorts onlookers and employees into one bucket per state, so every state can be updated by its own loop
 	 */
-	void CleanupOnlookers();
+	void SortIntoBuckets();
 
 	/**
-	 * Removes all employees marked for delete
+	 * Updates every bee in a bucket on the thread pool
+	 * @Param pool: The pool the bucket is spread across
+	 * @Param bucket: The bees being updated
+	 * @Param kernel: The update applied to each bee. Called directly for every bee within a chunk
 	 */
-	void CleanupEmployees();
+	template <typename T, typename Kernel>
+	static void RunKernel(ThreadPool& pool, std::vector<T*>& bucket, const Kernel& kernel);
 
 	/**
-	 * Removes all queens marked for delete
+	 * Removes all bees marked for delete, then destroys them
 	 */
-	void CleanupQueens();
+	void CleanupBees();
 
 	/**
-	 * Removes all droens marked for delete
+	 * Removes every bee marked for delete from a list in one stable pass. Removed bees are queued for destruction
+	 * and, if requested, tallied against their parent hive
+	 * @Param bees: The list being compacted. Surviving bees keep their relative order
+	 * @Param type: The type of bee in the list, used to return each removed bee to its pool
+	 * @Param tallyDeaths: True if the parent hives keep a count of this kind of bee
 	 */
-	void CleanupDrones();
+	template <typename T>
+	void CompactBees(std::vector<T*>& bees, const Bee::Type& type, const bool& tallyDeaths);
 
 	/**
-	 * Removes all guards marked for delete
+	 * Removes the tallied deaths from each hive's count in a single call per hive, then resets the tally
+	 * @Param type: The type of bee the tally was collected for
 	 */
-	void CleanupGuards();
+	void SettleDeathTally(const Hive::BeeType& type);
 
 	/**
-	 * Removes all larva marked for delete
+	 * Destructs a bee and returns its storage to the pool it was created from
+	 * @Param bee: The bee being destroyed
+	 * @Param type: The type of the bee, which selects its pool
 	 */
-	void CleanupLarva();
+	void DestroyBee(Bee* const bee, const Bee::Type& type);
 
 	static BeeManager* sInstance;
+	BeeStore mStore;
+	HandleTable<Bee> mHandles;
+	ObjectPool<OnlookerBee> mOnlookerPool;
+	ObjectPool<EmployedBee> mEmployeePool;
+	ObjectPool<QueenBee> mQueenPool;
+	ObjectPool<Drone> mDronePool;
+	ObjectPool<Guard> mGuardPool;
+	ObjectPool<Larva> mLarvaPool;
 	std::vector<class OnlookerBee*> mOnlookers;
 	std::vector<class EmployedBee*> mEmployees;
 	std::vector<class QueenBee*> mQueens;
 	std::vector<class Drone*> mDrones;
 	std::vector<class Guard*> mGuards;
 	std::vector<class Larva*> mLarva;
+	std::vector<Bee*> mUpdateOrder;
+	std::vector<std::vector<class OnlookerBee*>> mOnlookerBuckets;
+	std::vector<std::vector<class EmployedBee*>> mEmployeeBuckets;
+	std::vector<std::pair<Bee*, Bee::Type>> mGraveyard;
+	std::vector<std::pair<Hive*, int>> mDeathTally;
+	CommandBuffer mCommands;
 
 	const float FOOD_RETARGET_INTERVAL = 20.0f;
 	float mTimeSinceRetarget;
-	std::default_random_engine generator;
 };
 
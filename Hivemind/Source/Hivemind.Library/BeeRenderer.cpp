@@ -0,0 +1,110 @@
+#include "pch.h"
+#include "BeeRenderer.h"
+
+
+using namespace std;
+
+const uint32_t BeeRenderer::CIRCLE_SEGMENTS = 12;
+const float BeeRenderer::OUTLINE_THICKNESS = 2.0f;
+const float BeeRenderer::FACE_THICKNESS = 2.0f;
+
+BeeRenderer::BeeRenderer() :
+	mVertices(), mBeeCount(0)
+{
+}
+
+void BeeRenderer::Clear()
+{
+	mVertices.clear();
+	mBeeCount = 0;
+}
+
+void BeeRenderer::AddBee(const sf::Vector2f& center, const float& radius, const sf::Color& fillColor,
+	const sf::Color& outlineColor, const float& faceLength, const float& heading)
+{
+	// The outline is a full disc with the fill drawn over it, which leaves a ring of outline inside the radius
+	AddDisc(center, radius, outlineColor);
+	if (radius > OUTLINE_THICKNESS)
+	{
+		AddDisc(center, radius - OUTLINE_THICKNESS, fillColor);
+	}
+
+	if (faceLength > 0.0f)
+	{	// A thin quad from the center toward the heading, on the same side of the heading as a rotated rectangle
+		sf::Vector2f direction(cos(heading), sin(heading));
+		sf::Vector2f normal(-direction.y, direction.x);
+		sf::Vector2f tip = center + direction * faceLength;
+		sf::Vector2f width = normal * FACE_THICKNESS;
+
+		mVertices.emplace_back(center, sf::Color::White);
+		mVertices.emplace_back(tip, sf::Color::White);
+		mVertices.emplace_back(tip + width, sf::Color::White);
+		mVertices.emplace_back(center, sf::Color::White);
+		mVertices.emplace_back(tip + width, sf::Color::White);
+		mVertices.emplace_back(center + width, sf::Color::White);
+	}
+
+	mBeeCount++;
+}
+
+void BeeRenderer::AddPoint(const sf::Vector2f& center, const float& halfSize, const sf::Color& color)
+{
+	sf::Vector2f topLeft(center.x - halfSize, center.y - halfSize);
+	sf::Vector2f topRight(center.x + halfSize, center.y - halfSize);
+	sf::Vector2f bottomRight(center.x + halfSize, center.y + halfSize);
+	sf::Vector2f bottomLeft(center.x - halfSize, center.y + halfSize);
+
+	mVertices.emplace_back(topLeft, color);
+	mVertices.emplace_back(topRight, color);
+	mVertices.emplace_back(bottomRight, color);
+	mVertices.emplace_back(topLeft, color);
+	mVertices.emplace_back(bottomRight, color);
+	mVertices.emplace_back(bottomLeft, color);
+
+	mBeeCount++;
+}
+
+void BeeRenderer::Render(sf::RenderTarget& window) const
+{
+	if (!mVertices.empty())
+	{
+		window.draw(mVertices.data(), mVertices.size(), sf::Triangles);
+	}
+}
+
+uint32_t BeeRenderer::GetBeeCount() const
+{
+	return mBeeCount;
+}
+
+const vector<sf::Vertex>& BeeRenderer::GetVertices() const
+{
+	return mVertices;
+}
+
+const vector<sf::Vector2f>& BeeRenderer::UnitCircle()
+{
+	static const vector<sf::Vector2f> unitCircle = []()
+	{
+		const float fullTurn = 6.28318530718f;
+		vector<sf::Vector2f> points;
+		for (uint32_t i = 0; i <= CIRCLE_SEGMENTS; ++i)
+		{
+			float angle = (fullTurn * (i % CIRCLE_SEGMENTS)) / CIRCLE_SEGMENTS;
+			points.emplace_back(cos(angle), sin(angle));
+		}
+		return points;
+	}();
+	return unitCircle;
+}
+
+void BeeRenderer::AddDisc(const sf::Vector2f& center, const float& radius, const sf::Color& color)
+{
+	const auto& unitCircle = UnitCircle();
+	for (uint32_t i = 0; i < CIRCLE_SEGMENTS; ++i)
+	{
+		mVertices.emplace_back(center, color);
+		mVertices.emplace_back(center + unitCircle[i] * radius, color);
+		mVertices.emplace_back(center + unitCircle[i + 1] * radius, color);
+	}
+}
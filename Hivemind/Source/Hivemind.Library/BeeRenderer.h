@@ -0,0 +1,111 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+
+/**
+ * Collects the bodies and faces of many bees into one triangle list so a whole colony is drawn with a single draw
+ * call. Every body is built from the same low polygon unit circle, scaled and translated per bee, and the vertex
+ * storage is kept between frames so a renderer that is cleared and refilled each frame stops allocating once it has
+ * seen its largest colony
+ */
+class BeeRenderer
+{
+
+public:
+
+	/**
+	 * The number of sides of the polygon standing in for a bee's round body
+	 */
+	const static std::uint32_t CIRCLE_SEGMENTS;
+
+	/**
+	 * The width of a body's outline, drawn inside its radius
+	 */
+	const static float OUTLINE_THICKNESS;
+
+	/**
+	 * The width of the line marking the direction a bee is facing
+	 */
+	const static float FACE_THICKNESS;
+
+#pragma region Construction/Copy/Assignment
+
+	BeeRenderer();
+
+	~BeeRenderer() = default;
+
+	BeeRenderer(const BeeRenderer& rhs) = default;
+
+	BeeRenderer& operator=(const BeeRenderer& rhs) = default;
+
+	BeeRenderer(BeeRenderer&& rhs) = default;
+
+	BeeRenderer& operator=(BeeRenderer&& rhs) = default;
+
+#pragma endregion
+
+	/**
+	 * Removes every bee from the batch, keeping the storage for the next frame
+	 */
+	void Clear();
+
+	/**
+	 * Adds one bee to the batch
+	 * @Param center: The center of the bee's body, in world units
+	 * @Param radius: The radius of the bee's body
+	 * @Param fillColor: The color of the inside of the body
+	 * @Param outlineColor: The color of the body's outline
+	 * @Param faceLength: The length of the line marking the direction the bee is facing. Zero draws no face
+	 * @Param heading: The direction the bee is facing, in radians
+	 */
+	void AddBee(const sf::Vector2f& center, const float& radius, const sf::Color& fillColor,
+		const sf::Color& outlineColor, const float& faceLength, const float& heading);
+
+	/**
+	 * Adds one bee to the batch as a flat square, for when it is too small on screen for its outline and face to show
+	 * @Param center: The center of the bee's body, in world units
+	 * @Param halfSize: Half the width of the square
+	 * @Param color: The color of the square
+	 */
+	void AddPoint(const sf::Vector2f& center, const float& halfSize, const sf::Color& color);
+
+	/**
+	 * Draws every bee in the batch with one draw call
+	 * @Param window: The target being drawn to
+	 */
+	void Render(sf::RenderTarget& window) const;
+
+	/**
+	 * Accessor method for the number of bees in the batch
+	 * @Return: The number of bees added since the last Clear
+	 */
+	std::uint32_t GetBeeCount() const;
+
+	/**
+	 * Accessor method for the triangle list the batch is drawn from
+	 * @Return: Three vertices per triangle, in the order they were added
+	 */
+	const std::vector<sf::Vertex>& GetVertices() const;
+
+private:
+
+	/**
+	 * The corners of a polygon of radius one centered on the origin, built once and shared by every renderer
+	 * @Return: CIRCLE_SEGMENTS + 1 points, the last repeating the first so each segment can read its end point
+	 */
+	static const std::vector<sf::Vector2f>& UnitCircle();
+
+	/**
+	 * Adds a filled polygon as a fan of triangles around its center
+	 * @Param center: The center of the disc
+	 * @Param radius: The radius of the disc
+	 * @Param color: The color of the disc
+	 */
+	void AddDisc(const sf::Vector2f& center, const float& radius, const sf::Color& color);
+
+	std::vector<sf::Vertex> mVertices;
+	std::uint32_t mBeeCount;
+
+};
@@ -0,0 +1,160 @@
+#include "pch.h"
+#include "BeeStore.h"
+
+
+using namespace std;
+
+const uint32_t BeeStore::INITIAL_CAPACITY = 1024;
+
+BeeStore::BeeStore() :
+	mPositions(), mTargets(), mSpeeds(), mEnergies(), mEnergyConsumptionRates(), mFoodAmounts(), mStates(), mHiveIndices(), mOwners()
+{
+	mPositions.reserve(INITIAL_CAPACITY);
+	mTargets.reserve(INITIAL_CAPACITY);
+	mSpeeds.reserve(INITIAL_CAPACITY);
+	mEnergies.reserve(INITIAL_CAPACITY);
+	mEnergyConsumptionRates.reserve(INITIAL_CAPACITY);
+	mFoodAmounts.reserve(INITIAL_CAPACITY);
+	mStates.reserve(INITIAL_CAPACITY);
+	mHiveIndices.reserve(INITIAL_CAPACITY);
+	mOwners.reserve(INITIAL_CAPACITY);
+}
+
+uint32_t BeeStore::Allocate(Bee* const owner, const sf::Vector2f position, const uint32_t hiveIndex)
+{
+	auto slot = static_cast<uint32_t>(mOwners.size());
+	mPositions.push_back(position);
+	mTargets.push_back(position);
+	mSpeeds.push_back(0.0f);
+	mEnergies.push_back(0.0f);
+	mEnergyConsumptionRates.push_back(0.0f);
+	mFoodAmounts.push_back(0.0f);
+	mStates.push_back(Bee::State::Idle);
+	mHiveIndices.push_back(hiveIndex);
+	mOwners.push_back(owner);
+	return slot;
+}
+
+void BeeStore::Release(const uint32_t slot)
+{
+	if (slot >= mOwners.size())
+	{
+		throw out_of_range("Slot out of bounds");
+	}
+
+	auto last = static_cast<uint32_t>(mOwners.size() - 1);
+	if (slot != last)
+	{	// Fill the hole with the last bee so the arrays stay dense
+		mPositions[slot] = mPositions[last];
+		mTargets[slot] = mTargets[last];
+		mSpeeds[slot] = mSpeeds[last];
+		mEnergies[slot] = mEnergies[last];
+		mEnergyConsumptionRates[slot] = mEnergyConsumptionRates[last];
+		mFoodAmounts[slot] = mFoodAmounts[last];
+		mStates[slot] = mStates[last];
+		mHiveIndices[slot] = mHiveIndices[last];
+		mOwners[slot] = mOwners[last];
+		mOwners[slot]->mSlot = slot;
+	}
+
+	mPositions.pop_back();
+	mTargets.pop_back();
+	mSpeeds.pop_back();
+	mEnergies.pop_back();
+	mEnergyConsumptionRates.pop_back();
+	mFoodAmounts.pop_back();
+	mStates.pop_back();
+	mHiveIndices.pop_back();
+	mOwners.pop_back();
+}
+
+uint32_t BeeStore::Size() const
+{
+	return static_cast<uint32_t>(mOwners.size());
+}
+
+void BeeStore::ConsumeEnergy(const float& deltaTime)
+{
+	auto count = mEnergies.size();
+	auto energies = mEnergies.data();
+	auto rates = mEnergyConsumptionRates.data();
+	for (size_t i = 0; i < count; ++i)
+	{
+		energies[i] -= rates[i] * deltaTime;
+	}
+}
+
+sf::Vector2f& BeeStore::Position(const uint32_t slot)
+{
+	return mPositions[slot];
+}
+
+const sf::Vector2f& BeeStore::Position(const uint32_t slot) const
+{
+	return mPositions[slot];
+}
+
+sf::Vector2f& BeeStore::Target(const uint32_t slot)
+{
+	return mTargets[slot];
+}
+
+const sf::Vector2f& BeeStore::Target(const uint32_t slot) const
+{
+	return mTargets[slot];
+}
+
+float& BeeStore::Speed(const uint32_t slot)
+{
+	return mSpeeds[slot];
+}
+
+float BeeStore::Speed(const uint32_t slot) const
+{
+	return mSpeeds[slot];
+}
+
+float& BeeStore::Energy(const uint32_t slot)
+{
+	return mEnergies[slot];
+}
+
+float BeeStore::Energy(const uint32_t slot) const
+{
+	return mEnergies[slot];
+}
+
+float& BeeStore::EnergyConsumptionRate(const uint32_t slot)
+{
+	return mEnergyConsumptionRates[slot];
+}
+
+float BeeStore::EnergyConsumptionRate(const uint32_t slot) const
+{
+	return mEnergyConsumptionRates[slot];
+}
+
+float& BeeStore::FoodAmount(const uint32_t slot)
+{
+	return mFoodAmounts[slot];
+}
+
+float BeeStore::FoodAmount(const uint32_t slot) const
+{
+	return mFoodAmounts[slot];
+}
+
+Bee::State& BeeStore::State(const uint32_t slot)
+{
+	return mStates[slot];
+}
+
+Bee::State BeeStore::State(const uint32_t slot) const
+{
+	return mStates[slot];
+}
+
+uint32_t BeeStore::HiveIndex(const uint32_t slot) const
+{
+	return mHiveIndices[slot];
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <vector>
+#include "Bee.h"
+
+
+/**
+ * Contiguous storage for the per-tick state of every bee. Each field lives in its own array indexed by the bee's
+ * slot, so loops that touch one or two fields of every bee stream through memory instead of hopping between
+ * kilobyte sized bee objects. Shapes, text and other presentation data stay on the bee itself
+ */
+class BeeStore
+{
+
+public:
+
+	const static std::uint32_t INITIAL_CAPACITY;
+
+#pragma region Construction/Copy/Assignment
+
+	BeeStore();
+
+	~BeeStore() = default;
+
+	BeeStore(const BeeStore& rhs) = delete;
+
+	BeeStore& operator=(const BeeStore& rhs) = delete;
+
+	BeeStore(BeeStore&& rhs) = delete;
+
+	BeeStore& operator=(BeeStore&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Reserves a slot for a new bee at the end of every array
+	 * @Param owner: The bee that will own the slot
+	 * @Param position: The starting position of the bee. Taken by value since it may live in this store
+	 * @Param hiveIndex: The index of the bee's parent hive
+	 * @Return: The index of the new slot
+	 */
+	std::uint32_t Allocate(Bee* const owner, const sf::Vector2f position, const std::uint32_t hiveIndex);
+
+	/**
+	 * Frees a slot by moving the last slot into it, and tells the moved bee where its data went
+	 * @Param slot: The slot being freed
+	 */
+	void Release(const std::uint32_t slot);
+
+	/**
+	 * Accessor method for the number of allocated slots
+	 * @Return: The number of bees with data in the store
+	 */
+	std::uint32_t Size() const;
+
+	/**
+	 * Burns energy for every bee in the store
+	 * @Param deltaTime: The time since the last update
+	 */
+	void ConsumeEnergy(const float& deltaTime);
+
+#pragma region Fields
+
+	sf::Vector2f& Position(const std::uint32_t slot);
+	const sf::Vector2f& Position(const std::uint32_t slot) const;
+
+	sf::Vector2f& Target(const std::uint32_t slot);
+	const sf::Vector2f& Target(const std::uint32_t slot) const;
+
+	float& Speed(const std::uint32_t slot);
+	float Speed(const std::uint32_t slot) const;
+
+	float& Energy(const std::uint32_t slot);
+	float Energy(const std::uint32_t slot) const;
+
+	float& EnergyConsumptionRate(const std::uint32_t slot);
+	float EnergyConsumptionRate(const std::uint32_t slot) const;
+
+	float& FoodAmount(const std::uint32_t slot);
+	float FoodAmount(const std::uint32_t slot) const;
+
+	Bee::State& State(const std::uint32_t slot);
+	Bee::State State(const std::uint32_t slot) const;
+
+	std::uint32_t HiveIndex(const std::uint32_t slot) const;
+
+#pragma endregion
+
+private:
+
+	// Hot data, one entry per slot
+	std::vector<sf::Vector2f> mPositions;
+	std::vector<sf::Vector2f> mTargets;
+	std::vector<float> mSpeeds;
+	std::vector<float> mEnergies;
+	std::vector<float> mEnergyConsumptionRates;
+	std::vector<float> mFoodAmounts;
+	std::vector<Bee::State> mStates;
+	std::vector<std::uint32_t> mHiveIndices;
+
+	// Back pointers used to patch a bee's slot when it is moved
+	std::vector<Bee*> mOwners;
+};
@@ -7,33 +7,17 @@ using namespace std;
 CollisionGrid* CollisionGrid::sInstance = nullptr;
 
 CollisionGrid::CollisionGrid():
-	mGridSize(50), mNodeSize(2000), mGridOrigin(-(mGridSize / 2.0f * mNodeSize), -(mGridSize / 2.0f * mNodeSize)),
-	mVisible(false)
+	mNodes(), mNodeSize(DEFAULT_NODE_SIZE)
 {
-	mGrid = new CollisionNode*[mGridSize];
-	for (int i = 0; i < mGridSize; i++)
-	{
-		mGrid[i] = new CollisionNode[mGridSize];
-	}
-
-	for (int i = 0; i < mGridSize; i++)
-	{
-		for (int j = 0; j < mGridSize; j++)
-		{
-			mGrid[i][j].SetSize(mNodeSize);
-			sf::Vector2f position(i * mNodeSize, j * mNodeSize);
-			mGrid[i][j].SetPosition(mGridOrigin + position);
-		}
-	}
 }
 
 CollisionGrid::~CollisionGrid()
 {
-	for (int i = 0; i < mGridSize; i++)
+	for (auto iter = mNodes.begin(); iter != mNodes.end(); ++iter)
 	{
-		delete[] mGrid[i];
+		delete iter->second;
 	}
-	delete[] mGrid;
+	mNodes.clear();
 }
 
 CollisionGrid* CollisionGrid::GetInstance()
@@ -45,79 +29,120 @@ CollisionGrid* CollisionGrid::GetInstance()
 	return sInstance;
 }
 
-void CollisionGrid::Render(sf::RenderWindow& window) const
+CollisionNode* CollisionGrid::CollisionNodeFromPosition(const sf::Vector2f& position)
 {
-	if (mVisible)
-	{
-		for (int i = 0; i < mGridSize; i++)
-		{
-			for (int j = 0; j < mGridSize; j++)
-			{
-				mGrid[i][j].Render(window);
-			}
-		}
+	auto cell = CellFromPosition(position);
+	auto& node = mNodes[KeyFromCell(cell)];
+	if (node == nullptr)
+	{	// First entity in this cell
+		node = new CollisionNode();
+		node->SetSize(mNodeSize);
+		node->SetPosition(sf::Vector2f(static_cast<float>(cell.x) * mNodeSize, static_cast<float>(cell.y) * mNodeSize));
+		node->SetCell(cell);
 	}
+	return node;
 }
 
-void CollisionGrid::ToggleGridVisualization()
+CollisionNode* CollisionGrid::FindCollisionNode(const sf::Vector2i& cell) const
 {
-	mVisible = !mVisible;
+	auto iter = mNodes.find(KeyFromCell(cell));
+	return (iter != mNodes.end()) ? iter->second : nullptr;
 }
 
-CollisionNode* CollisionGrid::CollisionNodeFromPosition(const sf::Vector2f& position) const
+sf::Vector2i CollisionGrid::CellFromPosition(const sf::Vector2f& position) const
 {
-	sf::Vector2f nodeOffset = (position - mGridOrigin) / static_cast<float>(mNodeSize);
-	return &mGrid[static_cast<int>(nodeOffset.x)][static_cast<int>(nodeOffset.y)];
+	return sf::Vector2i(
+		static_cast<int>(floor(position.x / mNodeSize)),
+		static_cast<int>(floor(position.y / mNodeSize)));
 }
 
-vector<CollisionNode*> CollisionGrid::NeighborsOf(CollisionNode* const node) const
+CollisionGrid::NeighborList CollisionGrid::NeighborsOf(const CollisionNode* const node) const
 {
-	vector<CollisionNode*> neighbors;
+	NeighborList neighbors;
+	for (uint32_t i = 1; i < NEIGHBORHOOD_SIZE; ++i)
+	{
+		auto neighbor = FindCollisionNode(node->GetCell() + NeighborhoodOffset(i));
+		if (neighbor != nullptr)
+		{
+			neighbors.mNodes[neighbors.mCount++] = neighbor;
+		}
+	}
+	return neighbors;
+}
 
-	for (int i = 0; i < mGridSize; i++)
+void CollisionGrid::ReleaseEmptyNodes()
+{
+	for (auto iter = mNodes.begin(); iter != mNodes.end();)
 	{
-		for (int j = 0; j < mGridSize; j++)
+		if (iter->second->IsEmpty())
+		{
+			delete iter->second;
+			iter = mNodes.erase(iter);
+		}
+		else
 		{
-			if (&mGrid[i][j] == node)
-			{
-				if ((i - 1) >= 0)
-				{	// left
-					neighbors.push_back(&mGrid[i - 1][j]);
-
-					if ((j - 1) >= 0)
-					{	// top-left
-						neighbors.push_back(&mGrid[i - 1][j - 1]);
-					}
-					if ((j + 1) < mGridSize)
-					{	// bottom-left
-						neighbors.push_back(&mGrid[i - 1][j + 1]);
-					}
-				}
-				if ((i + 1) < mGridSize)
-				{	// right
-					neighbors.push_back(&mGrid[i + 1][j]);
-
-					if ((j + 1) < mGridSize)
-					{	// bottom-right
-						neighbors.push_back(&mGrid[i + 1][j + 1]);
-					}
-					if (j - 1 >= 0)
-					{	// top-right
-						neighbors.push_back(&mGrid[i + 1][j - 1]);
-					}
-				}
-				if ((j - 1 >= 0))
-				{	// top
-					neighbors.push_back(&mGrid[i][j - 1]);
-				}
-				if ((j + 1 < mGridSize))
-				{	// bottom
-					neighbors.push_back(&mGrid[i][j + 1]);
-				}
-				break;
-			}
+			++iter;
 		}
 	}
+}
 
-	return neighbors;
+void CollisionGrid::SetNodeSize(const int& nodeSize)
+{
+	if (!mNodes.empty())
+	{
+		throw runtime_error("Cannot resize an occupied collision grid");
+	}
+	assert(nodeSize > 0);
+	mNodeSize = nodeSize;
+}
+
+int CollisionGrid::GetNodeSize() const
+{
+	return mNodeSize;
+}
+
+uint32_t CollisionGrid::GetNodeCount() const
+{
+	return static_cast<uint32_t>(mNodes.size());
+}
+
+sf::Vector2i CollisionGrid::NeighborhoodOffset(const uint32_t& index)
+{
+	// Center, left, top-left, bottom-left, right, bottom-right, top-right, top, bottom
+	static const int offsets[NEIGHBORHOOD_SIZE][2] =
+	{
+		{ 0, 0 }, { -1, 0 }, { -1, -1 }, { -1, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 }, { 0, -1 }, { 0, 1 }
+	};
+	assert(index < NEIGHBORHOOD_SIZE);
+	return sf::Vector2i(offsets[index][0], offsets[index][1]);
+}
+
+uint64_t CollisionGrid::KeyFromCell(const sf::Vector2i& cell)
+{
+	return (static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) << 32) | static_cast<uint32_t>(cell.y);
+}
+
+CollisionGrid::NeighborList::NeighborList():
+	mCount(0)
+{}
+
+uint32_t CollisionGrid::NeighborList::size() const
+{
+	return mCount;
+}
+
+CollisionNode* CollisionGrid::NeighborList::operator[](const uint32_t& index) const
+{
+	assert(index < mCount);
+	return mNodes[index];
+}
+
+CollisionNode* const* CollisionGrid::NeighborList::begin() const
+{
+	return mNodes;
+}
+
+CollisionNode* const* CollisionGrid::NeighborList::end() const
+{
+	return mNodes + mCount;
 }
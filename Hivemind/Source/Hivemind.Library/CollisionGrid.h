@@ -1,9 +1,57 @@
 #pragma once
+#include <unordered_map>
 
 
 class CollisionGrid
 {
 
+public:
+
+	/**
+	 * Fixed capacity list of the nodes bordering a node. Returned by value so neighbor lookups never touch the heap
+	 */
+	class NeighborList
+	{
+
+	public:
+
+		NeighborList();
+
+		/**
+		 * Accessor method for the number of valid neighbors
+		 * @Return: The number of neighbors in the list, at most eight
+		 */
+		std::uint32_t size() const;
+
+		/**
+		 * Accessor method for a neighbor by index
+		 * @Param index: The index of the neighbor, less than size()
+		 * @Return: The neighbor at the specified index
+		 */
+		CollisionNode* operator[](const std::uint32_t& index) const;
+
+		/**
+		 * Accessor for the begin iterator of the neighbors
+		 * @Return: A pointer to the first neighbor
+		 */
+		CollisionNode* const* begin() const;
+
+		/**
+		 * Accessor for the end iterator of the neighbors
+		 * @Return: A pointer one past the last neighbor
+		 */
+		CollisionNode* const* end() const;
+
+	private:
+
+		friend class CollisionGrid;
+
+		static const std::uint32_t CAPACITY = 8;
+		CollisionNode* mNodes[CAPACITY];
+		std::uint32_t mCount;
+
+	};
+
 #pragma region Construction/Copy/Assignment
 
 private:
@@ -31,38 +79,211 @@ public:
 	static CollisionGrid* GetInstance();
 
 	/**
-	 * Renders the collision grid to the screen, if visible
-	 * @Param window: The screen that the grid is being rendered to
+	 * The width and height of a cell until SetNodeSize is called, in world units
+	 */
+	static const int DEFAULT_NODE_SIZE = 2000;
+
+	/**
+	 * Gets the collision node responsible for tracking entities in the specified position, allocating it if its cell
+	 * is unoccupied. Allocating mutates the grid, so this must not be called while bees are updating in parallel
+	 * @Param position: The world position of the entity in question
+	 * @Return: The collision node that is responsible for the position
 	 */
-	void Render(sf::RenderWindow& window) const;
+	class CollisionNode* CollisionNodeFromPosition(const sf::Vector2f& position);
 
 	/**
-	 *  Turns the visualization of the collision grid on/off
+	 * Finds the collision node responsible for a cell without allocating one
+	 * @Param cell: The column and row of the cell in question
+	 * @Return: The collision node for the cell, or nullptr if the cell is unoccupied
 	 */
-	void ToggleGridVisualization();
+	CollisionNode* FindCollisionNode(const sf::Vector2i& cell) const;
 
 	/**
-	 * Gets the collision node responsible for tracking entities in the specified position
-	 * @Param position: The world position of the entity in question
-	 * @Return: The collision node that is responsible for the position
+	 * Converts a world position to the cell that contains it
+	 * @Param position: The world position being converted
+	 * @Return: The column and row of the cell containing the position
 	 */
-	class CollisionNode* CollisionNodeFromPosition(const sf::Vector2f& position) const;
+	sf::Vector2i CellFromPosition(const sf::Vector2f& position) const;
 
 	/**
-	 * Gets all valid neighbor nodes of the specified node. Used for handling overlapping collisions
+	 * Gets all allocated neighbor nodes of the specified node. Used for handling overlapping collisions
 	 * @Param node: The node being checked for neighbors
-	 * @Return: A vector containing all valid neighbors of the node
+	 * @Return: A fixed capacity list containing all allocated neighbors of the node
+	 */
+	NeighborList NeighborsOf(const CollisionNode* const node) const;
+
+	/**
+	 * Visits the allocated nodes of the 3x3 block around a cell in place, center first, stopping as soon as the
+	 * visitor returns true
+	 * @Param cell: The cell at the center of the query
+	 * @Param visitor: Callable taking a CollisionNode&, returning true to end the query early
+	 * @Return: True if the visitor ended the query early
+	 */
+	template <typename Visitor>
+	bool QueryAround(const sf::Vector2i& cell, const Visitor& visitor) const;
+
+	/**
+	 * Visits the allocated nodes of the 3x3 block around the cell containing a position
+	 * @Param position: The world position at the center of the query
+	 * @Param visitor: Callable taking a CollisionNode&, returning true to end the query early
+	 * @Return: True if the visitor ended the query early
+	 */
+	template <typename Visitor>
+	bool QueryAround(const sf::Vector2f& position, const Visitor& visitor) const;
+
+	/**
+	 * Visits the allocated nodes of every cell overlapping an axis aligned box, row by row, stopping as soon as the
+	 * visitor returns true. Used for queries whose reach is not tied to the cell size
+	 * @Param minimum: The top left corner of the box, in world units
+	 * @Param maximum: The bottom right corner of the box, in world units
+	 * @Param visitor: Callable taking a CollisionNode&, returning true to end the query early
+	 * @Return: True if the visitor ended the query early
+	 */
+	template <typename Visitor>
+	bool QueryRegion(const sf::Vector2f& minimum, const sf::Vector2f& maximum, const Visitor& visitor) const;
+
+	/**
+	 * Visits the allocated nodes of every cell overlapping an axis aligned box, in no particular order. When the box
+	 * spans more cells than are allocated, the allocated nodes are scanned instead, so a box larger than the world
+	 * costs no more than the world itself. Meant for render passes, which do not depend on the order they draw in
+	 * @Param area: The box being queried, in world units
+	 * @Param visitor: Callable taking a CollisionNode&
 	 */
-	std::vector<CollisionNode*> NeighborsOf(CollisionNode* const node) const;
+	template <typename Visitor>
+	void QueryVisible(const sf::FloatRect& area, const Visitor& visitor) const;
+
+	/**
+	 * Frees every node that no longer has any entity registered with it. Called once per step, after all updates
+	 */
+	void ReleaseEmptyNodes();
+
+	/**
+	 * Mutator method for the square size of each cell. Only valid while no nodes are allocated
+	 * @Param nodeSize: The new width and height of a cell, in world units
+	 * @Exception: Thrown if nodes have already been allocated
+	 */
+	void SetNodeSize(const int& nodeSize);
+
+	/**
+	 * Accessor method for the square size of each cell
+	 * @Return: The width and height of a cell, in world units
+	 */
+	int GetNodeSize() const;
+
+	/**
+	 * Accessor method for the number of allocated nodes
+	 * @Return: The number of cells currently occupied by at least one entity
+	 */
+	std::uint32_t GetNodeCount() const;
+
+	/**
+	 * Packs a cell's column and row into a single hash key
+	 * @Param cell: The cell being packed
+	 * @Return: The key of the cell in the node map
+	 */
+	static std::uint64_t KeyFromCell(const sf::Vector2i& cell);
+
+	/**
+	 * Visits every allocated node, in no particular order
+	 * @Param visitor: Callable taking a CollisionNode&
+	 */
+	template <typename Visitor>
+	void QueryAll(const Visitor& visitor) const;
 
 private:
 
+	static const std::uint32_t NEIGHBORHOOD_SIZE = 9;
+
+	/**
+	 * Offsets of the 3x3 block around a cell, in visiting order. Index 0 is the cell itself
+	 * @Param index: The position within the block, less than NEIGHBORHOOD_SIZE
+	 * @Return: The offset from the center cell
+	 */
+	static sf::Vector2i NeighborhoodOffset(const std::uint32_t& index);
+
 	static CollisionGrid* sInstance;
-	class CollisionNode** mGrid;
-	int mGridSize;
+	std::unordered_map<std::uint64_t, CollisionNode*> mNodes;
 	int mNodeSize;
-	sf::Vector2f mGridOrigin;
-	bool mVisible;
 
 };
 
+template <typename Visitor>
+bool CollisionGrid::QueryAround(const sf::Vector2i& cell, const Visitor& visitor) const
+{
+	for (std::uint32_t i = 0; i < NEIGHBORHOOD_SIZE; ++i)
+	{
+		auto node = FindCollisionNode(cell + NeighborhoodOffset(i));
+		if (node != nullptr && visitor(*node))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+template <typename Visitor>
+bool CollisionGrid::QueryAround(const sf::Vector2f& position, const Visitor& visitor) const
+{
+	return QueryAround(CellFromPosition(position), visitor);
+}
+
+template <typename Visitor>
+bool CollisionGrid::QueryRegion(const sf::Vector2f& minimum, const sf::Vector2f& maximum, const Visitor& visitor) const
+{
+	auto first = CellFromPosition(minimum);
+	auto last = CellFromPosition(maximum);
+	for (int y = first.y; y <= last.y; ++y)
+	{
+		for (int x = first.x; x <= last.x; ++x)
+		{
+			auto node = FindCollisionNode(sf::Vector2i(x, y));
+			if (node != nullptr && visitor(*node))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+template <typename Visitor>
+void CollisionGrid::QueryVisible(const sf::FloatRect& area, const Visitor& visitor) const
+{
+	auto first = CellFromPosition(sf::Vector2f(area.left, area.top));
+	auto last = CellFromPosition(sf::Vector2f(area.left + area.width, area.top + area.height));
+	auto cellCount = static_cast<std::uint64_t>(last.x - first.x + 1) * static_cast<std::uint64_t>(last.y - first.y + 1);
+
+	if (cellCount <= mNodes.size())
+	{
+		for (int y = first.y; y <= last.y; ++y)
+		{
+			for (int x = first.x; x <= last.x; ++x)
+			{
+				auto node = FindCollisionNode(sf::Vector2i(x, y));
+				if (node != nullptr)
+				{
+					visitor(*node);
+				}
+			}
+		}
+		return;
+	}
+
+	for (auto iter = mNodes.begin(); iter != mNodes.end(); ++iter)
+	{
+		const auto& cell = iter->second->GetCell();
+		if (cell.x >= first.x && cell.x <= last.x && cell.y >= first.y && cell.y <= last.y)
+		{
+			visitor(*iter->second);
+		}
+	}
+}
+
+template <typename Visitor>
+void CollisionGrid::QueryAll(const Visitor& visitor) const
+{
+	for (auto iter = mNodes.begin(); iter != mNodes.end(); ++iter)
+	{
+		visitor(*iter->second);
+	}
+}
@@ -5,73 +5,48 @@
 using namespace std;
 
 CollisionNode::CollisionNode():
-	Entity(sf::Vector2f(), sf::Color(255, 255, 255, 32), sf::Color::Transparent), mSize(0)
+	mHives(), mFoodSources(), mBees(), mWasps(), mPosition(), mSize(0), mCell()
 {
-	mBorder.setOutlineThickness(-40);
-	mBorder.setOutlineColor(mOutlineColor);
-	mBorder.setFillColor(mFillColor);
-
-	mText.setFont(FontManager::GetInstance()->Hack());
-	mText.setCharacterSize(64);
-	mText.setOutlineColor(sf::Color::White);
-	mText.setFillColor(sf::Color::White);
-	UpdateTextDisplay();
 }
 
 CollisionNode::CollisionNode(const sf::Vector2f& position, const int& size):
-	Entity(position, sf::Color::White, sf::Color::Transparent), mSize(size)
+	mHives(), mFoodSources(), mBees(), mWasps(), mPosition(position), mSize(size), mCell()
 {
-	mBorder.setSize(sf::Vector2f(size, size));
-	mBorder.setOutlineThickness(-4);
-	mBorder.setOutlineColor(mOutlineColor);
-	mBorder.setFillColor(mFillColor);
-
-	mText.setFont(FontManager::GetInstance()->Hack());
-	mText.setCharacterSize(16);
-	mText.setOutlineColor(sf::Color::White);
-	mText.setFillColor(sf::Color::White);
-	UpdateTextDisplay();
 }
 
-CollisionNode::~CollisionNode()
+void CollisionNode::SetPosition(const sf::Vector2f& position)
 {
+	mPosition = position;
 }
 
-void CollisionNode::Update(sf::RenderWindow& window, const double& deltaTime)
+const sf::Vector2f& CollisionNode::GetPosition() const
 {
-	UNREFERENCED_PARAMETER(window);
-	UNREFERENCED_PARAMETER(deltaTime);
-	UpdateTextDisplay();
+	return mPosition;
 }
 
-void CollisionNode::Render(sf::RenderWindow& window) const
+void CollisionNode::SetSize(const int& size)
 {
-	window.draw(mBorder);
-	window.draw(mText);
+	mSize = size;
 }
 
-void CollisionNode::SetPosition(const sf::Vector2f& position)
+int CollisionNode::GetSize() const
 {
-	Entity::SetPosition(position);
-	mBorder.setPosition(position);
-	mText.setPosition(mPosition + sf::Vector2f(50, 50));
+	return mSize;
 }
 
-void CollisionNode::SetSize(const int& size)
+void CollisionNode::SetCell(const sf::Vector2i& cell)
 {
-	mSize = size;
-	mBorder.setSize(sf::Vector2f(mSize, mSize));
+	mCell = cell;
 }
 
-int CollisionNode::GetSize() const
+const sf::Vector2i& CollisionNode::GetCell() const
 {
-	return mSize;
+	return mCell;
 }
 
 void CollisionNode::RegisterHive(Hive* const hive)
 {
 	mHives.push_back(hive);
-	UpdateTextDisplay();
 }
 
 void CollisionNode::UnregisterHive(Hive* const hive)
@@ -84,13 +59,11 @@ void CollisionNode::UnregisterHive(Hive* const hive)
 			break;
 		}
 	}
-	UpdateTextDisplay();
 }
 
 void CollisionNode::RegisterFoodSource(FoodSource* const foodSource)
 {
 	mFoodSources.push_back(foodSource);
-	UpdateTextDisplay();
 }
 
 void CollisionNode::UnregisterFoodSource(FoodSource* const foodSource)
@@ -103,13 +76,11 @@ void CollisionNode::UnregisterFoodSource(FoodSource* const foodSource)
 			break;
 		}
 	}
-	UpdateTextDisplay();
 }
 
 void CollisionNode::RegisterBee(Bee* const bee)
 {
 	mBees.push_back(bee);
-	UpdateTextDisplay();
 }
 
 void CollisionNode::UnregisterBee(Bee* const bee)
@@ -122,13 +93,11 @@ void CollisionNode::UnregisterBee(Bee* const bee)
 			break;
 		}
 	}
-	UpdateTextDisplay();
 }
 
 void CollisionNode::RegisterWasp(Wasp* const wasp)
 {
 	mWasps.push_back(wasp);
-	UpdateTextDisplay();
 }
 
 void CollisionNode::UnregisterWasp(Wasp* const wasp)
@@ -141,7 +110,6 @@ void CollisionNode::UnregisterWasp(Wasp* const wasp)
 			break;
 		}
 	}
-	UpdateTextDisplay();
 }
 
 bool CollisionNode::ContainsPoint(const sf::Vector2f& point) const
@@ -153,32 +121,27 @@ bool CollisionNode::ContainsPoint(const sf::Vector2f& point) const
 		point.y < (mPosition.y + mSize);
 }
 
-std::vector<Hive*> CollisionNode::Hives() const
+bool CollisionNode::IsEmpty() const
+{
+	return mHives.empty() && mFoodSources.empty() && mBees.empty() && mWasps.empty();
+}
+
+const std::vector<Hive*>& CollisionNode::Hives() const
 {
 	return mHives;
 }
 
-std::vector<FoodSource*> CollisionNode::FoodSources() const
+const std::vector<FoodSource*>& CollisionNode::FoodSources() const
 {
 	return mFoodSources;
 }
 
-std::vector<Bee*> CollisionNode::Bees() const
+const std::vector<Bee*>& CollisionNode::Bees() const
 {
 	return mBees;
 }
 
-std::vector<Wasp*> CollisionNode::Wasps() const
+const std::vector<Wasp*>& CollisionNode::Wasps() const
 {
 	return mWasps;
 }
-
-void CollisionNode::UpdateTextDisplay()
-{
-	stringstream ss;
-	ss << "Hives: " << mHives.size() << endl;
-	ss << "Food Sources: " << mFoodSources.size() << endl;
-	ss << "Bees: " << mBees.size() << endl;
-	ss << "Wasps: " << mWasps.size() << endl;
-	mText.setString(ss.str());
-}
@@ -1,10 +1,19 @@
 #pragma once
-#include "Entity.h"
+#include <vector>
+#include <SFML/Graphics.hpp>
 
 
+class Hive;
+class FoodSource;
+class Bee;
 class Wasp;
 
-class CollisionNode :public Entity
+/**
+ * One cell of the collision grid, holding the entities registered in it. Nodes are created and freed as entities move
+ * between cells, so a node holds nothing but its bounds and entity lists. The world renderer draws cells from world
+ * snapshots instead
+ */
+class CollisionNode
 {
 
 public:
@@ -15,7 +24,7 @@ public:
 
 	CollisionNode(const sf::Vector2f& position, const int& size);
 
-	virtual ~CollisionNode();
+	~CollisionNode() = default;
 
     CollisionNode(const CollisionNode& rhs) = delete;
 
@@ -28,23 +37,16 @@ public:
 #pragma endregion
 
 	/**
-	 * Updates the Collision Node
-	 * @Param window: The window that the collision node is being rendered to
-	 * @Param deltaTime: The time since last update call
+	 * Mutator method for the top left corner of the collision node
+	 * @Param position: The new position of the collision node
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void SetPosition(const sf::Vector2f& position);
 
 	/**
-	 * Renders the collision node to the window
-	 * @Param window: The window that the collision node is being rendered to
+	 * Accessor method for the top left corner of the collision node
+	 * @Return: The position of the collision node
 	 */
-	void Render(sf::RenderWindow& window) const override;
-
-	/**
-	 * Sets the position of the entity
-	 * @Param entity: the new position of the entity
-	 */
-	void SetPosition(const sf::Vector2f& position) override;
+	const sf::Vector2f& GetPosition() const;
 
 	/**
 	 * Mutator method for size
@@ -58,6 +60,18 @@ public:
 	 */
 	int GetSize() const;
 
+	/**
+	 * Mutator method for the integer coordinates of the node within its grid
+	 * @Param cell: The column and row of the node
+	 */
+	void SetCell(const sf::Vector2i& cell);
+
+	/**
+	 * Accessor method for the integer coordinates of the node within its grid
+	 * @Return: A vector containing the column and row of the node
+	 */
+	const sf::Vector2i& GetCell() const;
+
 	/**
 	 * Adds a hive to the known entities of the collision node
 	 * @Param hive: The hive being added to the collision node
@@ -113,47 +127,38 @@ public:
 	 */
 	bool ContainsPoint(const sf::Vector2f& point) const;
 
+	/**
+	 * Determines if any entity is registered with the collision node
+	 * @Return: True if no hives, food sources, bees or wasps are registered. False otherwise
+	 */
+	bool IsEmpty() const;
+
 	/**
 	 * Accessor method for the list of hive pointers registered with the collision node
-	 * @Return: A vector of hive pointers currently registered with the collision node
+	 * @Return: A view of the hive pointers currently registered with the collision node
 	 */
-	std::vector<Hive*> Hives() const;
+	const std::vector<Hive*>& Hives() const;
 
 	/**
 	* Accessor method for the list of food source pointers registered with the collision node
-	* @Return: A vector of food source pointers currently registered with the collision node
+	* @Return: A view of the food source pointers currently registered with the collision node
 	*/
-	std::vector<FoodSource*> FoodSources() const;
+	const std::vector<FoodSource*>& FoodSources() const;
 
 	/**
 	* Accessor method for the list of bee pointers registered with the collision node
-	* @Return: A vector of bee pointers currently registered with the collision node
+	* @Return: A view of the bee pointers currently registered with the collision node
 	*/
-	std::vector<Bee*> Bees() const;
+	const std::vector<Bee*>& Bees() const;
 
 	/**
 	 * Accessor method for the list of wasp pointers registered with the collision node
-	 * @Return: A vector of wasp pointers currently registered with the collision node;
+	 * @Return: A view of the wasp pointers currently registered with the collision node
 	 */
-	std::vector<Wasp*> Wasps() const;
+	const std::vector<Wasp*>& Wasps() const;
 
 private:
 
-	/**
-	 * Updates the textual representation of the data contained in the collision node
-	 */
-	void UpdateTextDisplay();
-
-	/**
-	 *  Border for debug rendering
-	 */
-	sf::RectangleShape mBorder;
-
-	/**
-	 *  Text for displaying debug info
-	 */
-	sf::Text mText;
-
 	/**
 	 *  Lists of registered entities in the collision node
 	 */
@@ -162,7 +167,11 @@ private:
 	std::vector<Bee*> mBees;
 	std::vector<Wasp*> mWasps;
 
-	// The square size of the collision node
+	// The top left corner and square size of the collision node
+	sf::Vector2f mPosition;
 	int mSize;
+
+	// The column and row of the node within its grid
+	sf::Vector2i mCell;
 };
 
@@ -0,0 +1,62 @@
+#include "pch.h"
+#include "CommandBuffer.h"
+
+
+using namespace std;
+
+const uint32_t CommandBuffer::INITIAL_CAPACITY = 256;
+
+CommandBuffer::CommandBuffer() :
+	mCommands()
+{
+	mCommands.reserve(INITIAL_CAPACITY);
+}
+
+void CommandBuffer::SpawnBee(const Bee::Type& type, const sf::Vector2f& position, Hive& hive)
+{
+	assert(type != Bee::Type::Larva);
+	mCommands.push_back({ type, Larva::LarvaType::Onlooker, position, &hive });
+}
+
+void CommandBuffer::SpawnLarva(const sf::Vector2f& position, Hive& hive, const Larva::LarvaType& larvaType)
+{
+	mCommands.push_back({ Bee::Type::Larva, larvaType, position, &hive });
+}
+
+void CommandBuffer::Append(const CommandBuffer& other)
+{
+	mCommands.insert(mCommands.end(), other.mCommands.begin(), other.mCommands.end());
+}
+
+void CommandBuffer::Clear()
+{
+	mCommands.clear();
+}
+
+uint32_t CommandBuffer::Count(const Bee::Type& type) const
+{
+	uint32_t count = 0;
+	for (auto iter = mCommands.begin(); iter != mCommands.end(); ++iter)
+	{
+		if (iter->mBeeType == type)
+		{
+			count++;
+		}
+	}
+	return count;
+}
+
+uint32_t CommandBuffer::Size() const
+{
+	return static_cast<uint32_t>(mCommands.size());
+}
+
+vector<CommandBuffer::Command>::const_iterator CommandBuffer::Begin() const
+{
+	return mCommands.begin();
+}
+
+vector<CommandBuffer::Command>::const_iterator CommandBuffer::End() const
+{
+	return mCommands.end();
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <vector>
+#include "Bee.h"
+#include "Larva.h"
+
+
+/**
+ * Records changes to the bee population while the simulation steps, so the bee lists and hive counts are only
+ * modified once every system has finished. Commands are plain data and replay in the order they were recorded.
+ * A buffer is not thread-safe; concurrent writers each record into their own buffer, and appending those buffers
+ * in a fixed order (e.g. by worker index) keeps the flush independent of thread scheduling
+ */
+class CommandBuffer
+{
+
+public:
+
+	const static std::uint32_t INITIAL_CAPACITY;
+
+	/**
+	 * A single recorded spawn
+	 */
+	struct Command
+	{
+		Bee::Type mBeeType;
+		Larva::LarvaType mLarvaType;
+		sf::Vector2f mPosition;
+		Hive* mHive;
+	};
+
+#pragma region Construction/Copy/Assignment
+
+	CommandBuffer();
+
+	~CommandBuffer() = default;
+
+	CommandBuffer(const CommandBuffer& rhs) = delete;
+
+	CommandBuffer& operator=(const CommandBuffer& rhs) = delete;
+
+	CommandBuffer(CommandBuffer&& rhs) = delete;
+
+	CommandBuffer& operator=(CommandBuffer&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Records the birth of an adult bee
+	 * @Param type: The type of bee being spawned. Larvae are recorded through SpawnLarva
+	 * @Param position: The position the bee will be spawned at
+	 * @Param hive: The hive the bee will belong to
+	 */
+	void SpawnBee(const Bee::Type& type, const sf::Vector2f& position, Hive& hive);
+
+	/**
+	 * Records a larva being laid
+	 * @Param position: The position the larva will be spawned at
+	 * @Param hive: The hive the larva will belong to
+	 * @Param larvaType: The type of bee the larva will hatch into
+	 */
+	void SpawnLarva(const sf::Vector2f& position, Hive& hive, const Larva::LarvaType& larvaType);
+
+	/**
+	 * Copies every command recorded in another buffer onto the end of this one
+	 * @Param other: The buffer being merged in. It is left unchanged
+	 */
+	void Append(const CommandBuffer& other);
+
+	/**
+	 * Forgets every recorded command, keeping the buffer's capacity for the next step
+	 */
+	void Clear();
+
+	/**
+	 * Counts the recorded commands that spawn a given type of bee
+	 * @Param type: The type of bee being counted
+	 * @Return: The number of pending spawns of that type
+	 */
+	std::uint32_t Count(const Bee::Type& type) const;
+
+	/**
+	 * Accessor method for the number of recorded commands
+	 * @Return: The number of commands waiting to be flushed
+	 */
+	std::uint32_t Size() const;
+
+	/**
+	 * Accessor method for the begin iterator of the recorded commands
+	 * @Return: An iterator pointing to the oldest command
+	 */
+	std::vector<Command>::const_iterator Begin() const;
+
+	/**
+	 * Accessor method for the end iterator of the recorded commands
+	 * @Return: An iterator pointing past the newest command
+	 */
+	std::vector<Command>::const_iterator End() const;
+
+private:
+
+	std::vector<Command> mCommands;
+
+};
@@ -0,0 +1,153 @@
+#include "pch.h"
+#include "DensityMap.h"
+
+
+using namespace std;
+
+const uint32_t DensityMap::SATURATION = 200;
+
+DensityMap::DensityMap() :
+	mFirstCell(0, 0), mSize(0, 0), mCounts(), mStamps(), mPixels(), mTexture(), mSprite(), mStamp(0), mChangedCount(0),
+	mTextureStale(false)
+{
+}
+
+void DensityMap::Update(const WorldSnapshot& snapshot, const sf::FloatRect& area)
+{
+	auto previousSize = mSize;
+	mChangedCount = 0;
+	mStamp++;
+
+	snapshot.QueryVisible(area, [this](const WorldSnapshot::CellState& cell)
+	{
+		auto index = TexelIndex(cell.mCell);
+		mStamps[index] = mStamp;
+		SetCount(index, cell.mBeeCount);
+	});
+
+	// Cells emptied since the last update are missing from the snapshot, so any count they still hold is cleared here
+	auto first = snapshot.CellFromPosition(sf::Vector2f(area.left, area.top));
+	auto last = snapshot.CellFromPosition(sf::Vector2f(area.left + area.width, area.top + area.height));
+	first.x = max(first.x, mFirstCell.x);
+	first.y = max(first.y, mFirstCell.y);
+	last.x = min(last.x, mFirstCell.x + mSize.x - 1);
+	last.y = min(last.y, mFirstCell.y + mSize.y - 1);
+	for (int y = first.y; y <= last.y; ++y)
+	{
+		for (int x = first.x; x <= last.x; ++x)
+		{
+			auto index = static_cast<uint32_t>((y - mFirstCell.y) * mSize.x + (x - mFirstCell.x));
+			if (mStamps[index] != mStamp && mCounts[index] != 0)
+			{
+				SetCount(index, 0);
+			}
+		}
+	}
+
+	if (mSize != previousSize)
+	{	// The texture is recreated at its new size, with every texel written below
+		mTexture.create(static_cast<unsigned>(mSize.x), static_cast<unsigned>(mSize.y));
+		mTexture.setSmooth(true);
+		float cellSize = static_cast<float>(snapshot.GetCellSize());
+		mSprite.setTexture(mTexture, true);
+		mSprite.setPosition(sf::Vector2f(mFirstCell) * cellSize);
+		mSprite.setScale(cellSize, cellSize);
+		mChangedCount = static_cast<uint32_t>(mCounts.size());
+		mTextureStale = true;
+	}
+
+	if (mTextureStale)
+	{	// One cell per texel keeps the whole texture small enough that uploading it in one call is cheapest
+		mTexture.update(mPixels.data());
+		mTextureStale = false;
+	}
+}
+
+void DensityMap::Render(sf::RenderTarget& window) const
+{
+	if (!mCounts.empty())
+	{
+		window.draw(mSprite);
+	}
+}
+
+uint32_t DensityMap::GetCount(const sf::Vector2i& cell) const
+{
+	auto offset = cell - mFirstCell;
+	if (offset.x < 0 || offset.y < 0 || offset.x >= mSize.x || offset.y >= mSize.y)
+	{
+		return 0;
+	}
+
+	return mCounts[offset.y * mSize.x + offset.x];
+}
+
+uint32_t DensityMap::GetChangedCount() const
+{
+	return mChangedCount;
+}
+
+uint32_t DensityMap::TexelIndex(const sf::Vector2i& cell)
+{
+	auto offset = cell - mFirstCell;
+	if (mCounts.empty() || offset.x < 0 || offset.y < 0 || offset.x >= mSize.x || offset.y >= mSize.y)
+	{	// Grow to the union of the old bounds and the new cell, carrying every known count over
+		sf::Vector2i first = mCounts.empty() ? cell : sf::Vector2i(min(mFirstCell.x, cell.x), min(mFirstCell.y, cell.y));
+		sf::Vector2i last = mCounts.empty() ? cell : sf::Vector2i(max(mFirstCell.x + mSize.x - 1, cell.x),
+			max(mFirstCell.y + mSize.y - 1, cell.y));
+		sf::Vector2i size(last.x - first.x + 1, last.y - first.y + 1);
+
+		vector<uint32_t> counts(size.x * size.y, 0);
+		vector<uint32_t> stamps(size.x * size.y, 0);
+		vector<sf::Uint8> pixels(size.x * size.y * 4, 0);
+		for (int y = 0; y < mSize.y; ++y)
+		{
+			for (int x = 0; x < mSize.x; ++x)
+			{
+				auto from = y * mSize.x + x;
+				auto to = (y + mFirstCell.y - first.y) * size.x + (x + mFirstCell.x - first.x);
+				counts[to] = mCounts[from];
+				stamps[to] = mStamps[from];
+				copy(mPixels.begin() + from * 4, mPixels.begin() + from * 4 + 4, pixels.begin() + to * 4);
+			}
+		}
+
+		mFirstCell = first;
+		mSize = size;
+		mCounts = move(counts);
+		mStamps = move(stamps);
+		mPixels = move(pixels);
+		offset = cell - mFirstCell;
+	}
+
+	return static_cast<uint32_t>(offset.y * mSize.x + offset.x);
+}
+
+void DensityMap::SetCount(const uint32_t& index, const uint32_t& count)
+{
+	if (mCounts[index] == count)
+	{
+		return;
+	}
+
+	mCounts[index] = count;
+	auto color = Heat(count);
+	mPixels[index * 4] = color.r;
+	mPixels[index * 4 + 1] = color.g;
+	mPixels[index * 4 + 2] = color.b;
+	mPixels[index * 4 + 3] = color.a;
+	mChangedCount++;
+	mTextureStale = true;
+}
+
+sf::Color DensityMap::Heat(const uint32_t& count)
+{
+	if (count == 0)
+	{
+		return sf::Color::Transparent;
+	}
+
+	// Counts are compared on a log scale so a lone bee still shows next to a hive holding hundreds
+	auto heat = min(1.0f, log(1.0f + count) / log(1.0f + SATURATION));
+	return sf::Color(255, static_cast<sf::Uint8>(220 * (1.0f - heat)), 0, static_cast<sf::Uint8>(96 + 159 * heat));
+}
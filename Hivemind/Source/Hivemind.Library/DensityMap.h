@@ -0,0 +1,100 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "WorldSnapshot.h"
+
+
+/**
+ * A heatmap of how many bees are registered in each collision cell, kept in a texture with one texel per cell and
+ * stretched over the world when drawn. Each update only visits the cells of a world snapshot that are in view and only
+ * rewrites the texels whose count has changed, so it costs the same however many bees are in those cells. The map
+ * grows to cover every cell it has seen and never shrinks
+ */
+class DensityMap
+{
+
+public:
+
+	/**
+	 * The number of bees in one cell at which its heat stops rising
+	 */
+	const static std::uint32_t SATURATION;
+
+#pragma region Construction/Copy/Assignment
+
+	DensityMap();
+
+	~DensityMap() = default;
+
+	DensityMap(const DensityMap& rhs) = delete;
+
+	DensityMap& operator=(const DensityMap& rhs) = delete;
+
+	DensityMap(DensityMap&& rhs) = delete;
+
+	DensityMap& operator=(DensityMap&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Brings the cells overlapping an area up to date with a snapshot, uploading the texture if any changed
+	 * @Param snapshot: The state of the world being drawn
+	 * @Param area: The part of the world in view, in world units
+	 */
+	void Update(const WorldSnapshot& snapshot, const sf::FloatRect& area);
+
+	/**
+	 * Draws the heatmap over every cell it covers
+	 * @Param window: The target being drawn to
+	 */
+	void Render(sf::RenderTarget& window) const;
+
+	/**
+	 * Accessor method for the number of bees a cell held when it was last updated
+	 * @Param cell: The coordinates of the cell
+	 * @Return: The bee count of the cell, or zero if the map has never covered it
+	 */
+	std::uint32_t GetCount(const sf::Vector2i& cell) const;
+
+	/**
+	 * Accessor method for the number of texels the last update rewrote
+	 * @Return: The number of cells whose count changed, or every cell if the map had to grow
+	 */
+	std::uint32_t GetChangedCount() const;
+
+private:
+
+	/**
+	 * Finds the texel of a cell, growing the map to cover the cell if it does not already
+	 * @Param cell: The coordinates of the cell
+	 * @Return: The index of the cell's texel
+	 */
+	std::uint32_t TexelIndex(const sf::Vector2i& cell);
+
+	/**
+	 * Records a cell's bee count and recolors its texel if the count changed
+	 * @Param index: The index of the cell's texel
+	 * @Param count: The number of bees registered in the cell
+	 */
+	void SetCount(const std::uint32_t& index, const std::uint32_t& count);
+
+	/**
+	 * Determines the color of a cell from its bee count
+	 * @Param count: The number of bees registered in the cell
+	 * @Return: Transparent for an empty cell, otherwise yellow through red as the count nears SATURATION
+	 */
+	static sf::Color Heat(const std::uint32_t& count);
+
+	sf::Vector2i mFirstCell;
+	sf::Vector2i mSize;
+	std::vector<std::uint32_t> mCounts;
+	std::vector<std::uint32_t> mStamps;
+	std::vector<sf::Uint8> mPixels;
+	sf::Texture mTexture;
+	sf::Sprite mSprite;
+	std::uint32_t mStamp;
+	std::uint32_t mChangedCount;
+	bool mTextureStale;
+
+};
@@ -8,25 +8,22 @@ Drone::Drone(const sf::Vector2f& position, Hive& hive) :
 	Bee(position, hive)
 {
 	mFillColor = sf::Color(128, 128, 128);
-	mBody.setFillColor(mFillColor);
 }
 
 Drone::~Drone()
 {
 }
 
-void Drone::Update(sf::RenderWindow& window, const double& deltaTime)
+void Drone::Update(const double& deltaTime)
 {
-	Bee::Update(window, deltaTime);
+	Bee::Update(deltaTime);
 
-	HandleCombManagement(deltaTime);
+	Defer([this, deltaTime]() { HandleCombManagement(static_cast<float>(deltaTime)); });
 
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	float rotationAngle = rotationRadians * (180 / PI);
-	sf::Vector2f newPosition = mPosition;
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
+	sf::Vector2f newPosition = Position();
 
-	if (DistanceBetween(mTarget, mPosition) <= TARGET_RADIUS)
+	if (DistanceBetween(Target(), Position()) <= TARGET_RADIUS)
 	{
 		auto dimensions = mParentHive.GetDimensions();
 		uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x / 2), static_cast<int>(dimensions.x / 2));
@@ -36,14 +33,10 @@ void Drone::Update(sf::RenderWindow& window, const double& deltaTime)
 	}
 
 	newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 
-	DetectStructureCollisions();
-	mPosition = newPosition;
-	mBody.setPosition(sf::Vector2f(mPosition.x - BodyRadius, mPosition.y - BodyRadius));
-	mFace.setPosition(mPosition.x, mPosition.y);
-	mFace.setRotation(rotationAngle);
+	Position() = newPosition;
 }
 
 void Drone::Render(sf::RenderWindow& window) const
@@ -55,16 +48,16 @@ void Drone::HandleCombManagement(const float& deltaTime) const
 {
 	if (mParentHive.RequiresHoneyComb())
 	{
-		mParentHive.ConvertToHoneyComb(mEnergyConsumptionRate * 50 * deltaTime);
+		mParentHive.ConvertToHoneyComb(EnergyConsumptionRate() * 50 * deltaTime);
 	}
 
 	if (mParentHive.RequiresBroodComb())
 	{
-		mParentHive.ConvertToBroodComb(mEnergyConsumptionRate * deltaTime);
+		mParentHive.ConvertToBroodComb(EnergyConsumptionRate() * deltaTime);
 	}
 
 	if (mParentHive.RequiresStructuralComb())
 	{
-		mParentHive.AddStructuralComb(mEnergyConsumptionRate * 25 * deltaTime);
+		mParentHive.AddStructuralComb(EnergyConsumptionRate() * 25 * deltaTime);
 	}
 }
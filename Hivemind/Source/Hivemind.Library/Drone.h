@@ -31,10 +31,9 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 * Render method called by the main game loop
@@ -42,11 +41,6 @@ public:
 	 */
 	void Render(sf::RenderWindow& window) const override;
 
-protected:
-
-	// Drones don't have state so we don't need to use the function map
-	void PopulateFunctionMaps() override {}
-
 private:
 
 	/**
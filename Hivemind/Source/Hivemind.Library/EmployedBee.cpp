@@ -5,43 +5,64 @@
 using namespace std;
 
 EmployedBee::EmployedBee(const sf::Vector2f& position, Hive& hive) :
-	Bee(position, hive), mPairedFoodSource(nullptr), mDisplayFlowField(false),
-	mLineToFoodSource(sf::LineStrip, 2), mFoodSourceData(0.0f, 0.0f), mAbandoningFoodSource(false)
+	Bee(position, hive), mPairedFoodSource(), mDisplayFlowField(false), mFoodSourceData(0.0f, 0.0f), mAbandoningFoodSource(false)
 {
-	mState = State::Scouting;
+	CurrentState() = State::Scouting;
 	mFillColor = sf::Color::Cyan;
-	mBody.setFillColor(mFillColor);
+}
 
-	EmployedBee::PopulateFunctionMaps();
+void EmployedBee::Update(const double& deltaTime)
+{
+	switch (CurrentState())
+	{
+	case State::Scouting:
+		StepScouting(deltaTime);
+		break;
+	case State::SeekingTarget:
+		StepSeekingTarget(deltaTime);
+		break;
+	case State::HarvestingFood:
+		StepHarvestingFood(deltaTime);
+		break;
+	case State::DeliveringFood:
+		StepDeliveringFood(deltaTime);
+		break;
+	case State::DepositingFood:
+		StepDepositingFood(deltaTime);
+		break;
+	default:
+		assert(false);
+	}
 }
 
-void EmployedBee::Update(sf::RenderWindow& window, const double& deltaTime)
+void EmployedBee::StepScouting(const double& deltaTime)
 {
-	Bee::Update(window, deltaTime);
+	Bee::Update(deltaTime);
+	UpdateScouting(static_cast<float>(deltaTime));
+}
 
-	assert(mState != State::Idle);
-	mUpdate[mState](window, deltaTime);
+void EmployedBee::StepSeekingTarget(const double& deltaTime)
+{
+	Bee::Update(deltaTime);
+	UpdateSeekingTarget(static_cast<float>(deltaTime));
+}
 
-	if (mPairedFoodSource != nullptr)
-	{
-		mLineToFoodSource[0].position = mPosition;
-		mLineToFoodSource[0].color = sf::Color(255, 0, 0, 64);
-		mLineToFoodSource[1].position = mPairedFoodSource->GetCenterTarget();
-		mLineToFoodSource[1].color = sf::Color(255, 0, 0, 64);
-	}
+void EmployedBee::StepHarvestingFood(const double& deltaTime)
+{
+	Bee::Update(deltaTime);
+	UpdateHarvestingFood(static_cast<float>(deltaTime));
 }
 
-void EmployedBee::Render(sf::RenderWindow& window) const
+void EmployedBee::StepDeliveringFood(const double& deltaTime)
 {
-	Bee::Render(window);
-	if (mState == State::Scouting && mDisplayFlowField)
-	{
-	}
+	Bee::Update(deltaTime);
+	UpdateDeliveringFood(static_cast<float>(deltaTime));
+}
 
-	if (mPairedFoodSource != nullptr && mState != State::Scouting)
-	{
-		//		window.draw(mLineToFoodSource);
-	}
+void EmployedBee::StepDepositingFood(const double& deltaTime)
+{
+	Bee::Update(deltaTime);
+	UpdateDepositingFood(static_cast<float>(deltaTime));
 }
 
 void EmployedBee::ToggleFlowField()
@@ -56,193 +77,139 @@ void EmployedBee::SetFlowFieldOctaveCount(const std::uint32_t& octaveCount)
 	//	mFlowField.SetOctaveCount(octaveCount);
 }
 
-void EmployedBee::PopulateFunctionMaps()
-{
-	mUpdate[State::Scouting] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateScouting(window, deltaTime); };
-
-	mUpdate[State::SeekingTarget] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateSeekingTarget(window, deltaTime); };
-
-	mUpdate[State::HarvestingFood] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateHarvestingFood(window, deltaTime); };
-
-	mUpdate[State::DeliveringFood] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateDeliveringFood(window, deltaTime); };
-
-	mUpdate[State::DepositingFood] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateDepositingFood(window, deltaTime); };
-}
-
 void EmployedBee::WaggleDance() const
 {
-	mParentHive.UpdateKnownFoodSource(mPairedFoodSource, mFoodSourceData);
+	if (!mPairedFoodSource.IsNull())
+	{	// A bee that has given up on its food source has nothing to report, but still joins the dance
+		mParentHive.UpdateKnownFoodSource(mPairedFoodSource, mFoodSourceData);
+	}
 	mParentHive.TriggerWaggleDance();
 }
 
-void EmployedBee::UpdateScouting(sf::RenderWindow& window, const float& deltaTime)
+void EmployedBee::UpdateScouting(const float& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
 	auto bounds = 10000;
-	if (mPosition.x < mParentHive.GetCenterTarget().x - bounds || mPosition.x > mParentHive.GetCenterTarget().x + bounds ||
-		mPosition.y < mParentHive.GetCenterTarget().y - bounds || mPosition.y > mParentHive.GetCenterTarget().y + bounds ||
-		(mEnergy / mMaxEnergy) < 0.30f)
+	if (Position().x < mParentHive.GetCenterTarget().x - bounds || Position().x > mParentHive.GetCenterTarget().x + bounds ||
+		Position().y < mParentHive.GetCenterTarget().y - bounds || Position().y > mParentHive.GetCenterTarget().y + bounds ||
+		(Energy() / mMaxEnergy) < 0.30f)
 	{
-		mState = State::DeliveringFood;
+		CurrentState() = State::DeliveringFood;
 	}
 
-	sf::Vector2f newPosition = mPosition;
-	float rotationRadians = atan2(mTarget.y - mPosition.y, mTarget.x - mPosition.x);
-	newPosition.x += (cos(rotationRadians) * mSpeed * deltaTime);
-	newPosition.y += (sin(rotationRadians) * mSpeed * deltaTime);
+	sf::Vector2f newPosition = Position();
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
+	newPosition.x += (cos(rotationRadians) * Speed() * deltaTime);
+	newPosition.y += (sin(rotationRadians) * Speed() * deltaTime);
 
-	if (DistanceBetween(mPosition, mTarget) <= mBody.getRadius())
+	if (DistanceBetween(Position(), Target()) <= BodyRadius)
 	{
 		GenerateNewTarget();
 	}
 
-	auto foodSources = FoodSourceManager::GetInstance();
-	for (auto iter = foodSources->Begin(); iter != foodSources->End(); ++iter)
+	auto foodSource = FindUnclaimedFoodSource();
+	if (foodSource != nullptr)
 	{
-		if (DetectingFoodSource(*(*iter)) && !(*iter)->ContainsRegisteredHive(&mParentHive))//!(*iter)->PairedWithEmployee())
-		{
-			mPairedFoodSource = (*iter);
-			mTargetFoodSource = (*iter);
-			mTargetFoodSource->SetPairedWithEmployee(true);
-			mTargetFoodSource->RegisterHive(&mParentHive);
-			SetTarget(mTargetFoodSource->GetCenterTarget());
-			mHarvestingClock.restart();
-			mState = State::HarvestingFood;
-			break;
-		}
+		mPairedFoodSource = foodSource->GetHandle();
+		mTargetFoodSource = foodSource->GetHandle();
+		Defer([this, foodSource]()
+		{	// Another scout from the same hive may have claimed it earlier this step
+			foodSource->SetPairedWithEmployee(true);
+			if (!foodSource->ContainsRegisteredHive(&mParentHive))
+			{
+				foodSource->RegisterHive(&mParentHive);
+			}
+		});
+		SetTarget(foodSource->GetCenterTarget());
+		RestartHarvestingTimer();
+		CurrentState() = State::HarvestingFood;
 	}
 
-	UpdatePosition(newPosition, rotationRadians);
+	Position() = newPosition;
 }
 
-void EmployedBee::UpdateSeekingTarget(sf::RenderWindow& window, const float& deltaTime)
+void EmployedBee::UpdateSeekingTarget(const float& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
 	auto newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 
-	UpdatePosition(newPosition, rotationRadians);
+	Position() = newPosition;
 
-	if (DistanceBetween(newPosition, mTarget) <= TARGET_RADIUS)
+	if (DistanceBetween(newPosition, Target()) <= TARGET_RADIUS)
 	{
-		mState = State::HarvestingFood;
-		mHarvestingClock.restart();
+		CurrentState() = State::HarvestingFood;
+		RestartHarvestingTimer();
 	}
 }
 
-void EmployedBee::UpdateHarvestingFood(sf::RenderWindow& window, const float& deltaTime)
+void EmployedBee::UpdateHarvestingFood(const float& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	auto newPosition = mPosition;
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
+	auto newPosition = Position();
+	auto foodSource = TargetFoodSource();
 
-	if (mTargetFoodSource != nullptr)
+	if (foodSource != nullptr)
 	{
-		if (DistanceBetween(mTarget, mPosition) <= TARGET_RADIUS)
+		if (DistanceBetween(Target(), Position()) <= TARGET_RADIUS)
 		{
-			auto dimensions = mTargetFoodSource->GetDimensions();
+			auto dimensions = foodSource->GetDimensions();
 			uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x / 2), static_cast<int>(dimensions.x / 2));
 			uniform_int_distribution<int> distributionY(static_cast<int>(-dimensions.y / 2), static_cast<int>(dimensions.y / 2));
 			sf::Vector2f offset(static_cast<float>(distributionX(mGenerator)), static_cast<float>(distributionY(mGenerator)));
-			SetTarget(mTargetFoodSource->GetCenterTarget() + offset);
+			SetTarget(foodSource->GetCenterTarget() + offset);
 		}
 
 		newPosition = sf::Vector2f(
-			mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-			mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+			Position().x + cos(rotationRadians) * Speed() * deltaTime,
+			Position().y + sin(rotationRadians) * Speed() * deltaTime);
 	}
 
-	mPosition = newPosition;
+	Position() = newPosition;
 
-	if (mHarvestingClock.getElapsedTime().asSeconds() >= mHarvestingDuration)
+	if (HarvestingTimeElapsed() >= mHarvestingDuration)
 	{
-		HarvestFood(mTargetFoodSource->TakeFood(EXTRACTION_YIELD));
-		if (mTargetFoodSource->GetFoodAmount() == 0.0f)
-		{	// We just learned that the food source is no longer viable
-			mAbandoningFoodSource = true;
-		}
-		mFoodSourceData.first = mTargetFoodSource->GetFoodAmount();
-		mFoodSourceData.second = DistanceBetween(mTargetFoodSource->GetCenterTarget(), mParentHive.GetCenterTarget());
-		mTargeting = false;
-		mState = State::DeliveringFood;
-	}
-
-	SetColor(Bee::NORMAL_COLOR);
-
-	auto foodSources = mCollisionNode->FoodSources();
-	bool foodSourceFound = false;
-	for (auto iter = foodSources.begin(); iter != foodSources.end(); ++iter)
-	{
-		if (CollidingWithFoodSource(*(*iter)))
-		{
-			foodSourceFound = true;
-			SetColor(Bee::ALERT_COLOR);
-			break;
-		}
-	}
-
-	if (!foodSourceFound)
-	{	// We need to search the neighbors now
-		vector<CollisionNode*> neighbors = CollisionGrid::GetInstance()->NeighborsOf(mCollisionNode);
-		for (uint32_t i = 0; i < neighbors.size(); i++)
+		if (foodSource != nullptr)
 		{
-			auto neighborFoodSources = neighbors[i]->FoodSources();
-			for (auto iter = neighborFoodSources.begin(); iter != neighborFoodSources.end(); ++iter)
+			Defer([this, foodSource]()
 			{
-				foodSourceFound = true;
-				SetColor(Bee::ALERT_COLOR);
-				break;
-			}
-			if (foodSourceFound)
-			{	// Early out if we find a collision
-				break;
-			}
+				HarvestFood(foodSource->TakeFood(EXTRACTION_YIELD));
+				if (foodSource->GetFoodAmount() == 0.0f)
+				{	// We just learned that the food source is no longer viable
+					mAbandoningFoodSource = true;
+				}
+				mFoodSourceData.first = foodSource->GetFoodAmount();
+				mFoodSourceData.second = DistanceBetween(foodSource->GetCenterTarget(), mParentHive.GetCenterTarget());
+			});
 		}
+		mTargeting = false;
+		CurrentState() = State::DeliveringFood;
 	}
-
-	UpdatePosition(newPosition, rotationRadians);
 }
 
-void EmployedBee::UpdateDeliveringFood(sf::RenderWindow& window, const float& deltaTime)
+void EmployedBee::UpdateDeliveringFood(const float& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	mTarget = mParentHive.GetCenterTarget();
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
+	Target() = mParentHive.GetCenterTarget();
 
 	auto newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 
 	if (DistanceBetween(newPosition, mParentHive.GetCenterTarget()) <= TARGET_RADIUS)
 	{
-		mState = State::DepositingFood;
-		mHarvestingClock.restart();
+		CurrentState() = State::DepositingFood;
+		RestartHarvestingTimer();
 	}
 
-	UpdatePosition(newPosition, rotationRadians);
+	Position() = newPosition;
 }
 
-void EmployedBee::UpdateDepositingFood(sf::RenderWindow& window, const float& deltaTime)
+void EmployedBee::UpdateDepositingFood(const float& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
 
-	if (DistanceBetween(mTarget, mPosition) <= TARGET_RADIUS)
+	if (DistanceBetween(Target(), Position()) <= TARGET_RADIUS)
 	{
 		auto dimensions = mParentHive.GetDimensions();
 		uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x / 2), static_cast<int>(dimensions.x / 2));
@@ -252,92 +219,77 @@ void EmployedBee::UpdateDepositingFood(sf::RenderWindow& window, const float& de
 	}
 
 	auto newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 
-	mPosition = newPosition;
-	UpdatePosition(newPosition, rotationRadians);
+	Position() = newPosition;
 
-	if (mHarvestingClock.getElapsedTime().asSeconds() >= mHarvestingDuration)
+	if (HarvestingTimeElapsed() >= mHarvestingDuration)
 	{	// Now we go back to looking for another food source
-		DepositFood(mFoodAmount);
 		mTargeting = false;
-		if (mPairedFoodSource != nullptr)
-		{
-			SetTarget(mPairedFoodSource->GetCenterTarget());
-		}
-		mState = (mPairedFoodSource == nullptr) ? State::Scouting : State::SeekingTarget;
-		SetColor(Bee::NORMAL_COLOR);
-		WaggleDance();
-
-		if (mAbandoningFoodSource)
-		{	// If food source is marked for abandon, we forget about it and tell the hive to forget about it
-			mParentHive.RemoveFoodSource(mPairedFoodSource);
-			if (mPairedFoodSource != nullptr)
-			{
-				mPairedFoodSource->SetPairedWithEmployee(false);
-				mPairedFoodSource->UnregisterHive(&mParentHive);
-			}
-			mPairedFoodSource = nullptr;
-			mAbandoningFoodSource = false;
-		}
-	}
-
-	SetColor(Bee::NORMAL_COLOR);
-
-	auto foodSources = mCollisionNode->FoodSources();
-	bool foodSourceFound = false;
-	for (auto iter = foodSources.begin(); iter != foodSources.end(); ++iter)
-	{
-		if (CollidingWithFoodSource(*(*iter)))
+		auto pairedFoodSource = PairedFoodSource();
+		if (pairedFoodSource != nullptr)
 		{
-			foodSourceFound = true;
-			SetColor(Bee::ALERT_COLOR);
-			break;
+			SetTarget(pairedFoodSource->GetCenterTarget());
 		}
-	}
+		CurrentState() = (pairedFoodSource == nullptr) ? State::Scouting : State::SeekingTarget;
 
-	if (!foodSourceFound)
-	{
-		vector<CollisionNode*> neighbors = CollisionGrid::GetInstance()->NeighborsOf(mCollisionNode);
-		for (uint32_t i = 0; i < neighbors.size(); i++)
+		Defer([this]()
 		{
-			auto neighborFoodSources = neighbors[i]->FoodSources();
-			for (auto iter = neighborFoodSources.begin(); iter != neighborFoodSources.end(); ++iter)
-			{
-				if (CollidingWithFoodSource(*(*iter)))
+			DepositFood(FoodAmount());
+			WaggleDance();
+
+			if (mAbandoningFoodSource)
+			{	// If food source is marked for abandon, we forget about it and tell the hive to forget about it
+				mParentHive.RemoveFoodSource(mPairedFoodSource);
+				auto abandonedFoodSource = PairedFoodSource();
+				if (abandonedFoodSource != nullptr)
 				{
-					foodSourceFound = true;
-					SetColor(Bee::ALERT_COLOR);
-					break;
+					abandonedFoodSource->SetPairedWithEmployee(false);
+					abandonedFoodSource->UnregisterHive(&mParentHive);
 				}
+				mPairedFoodSource = Handle<FoodSource>();
+				mAbandoningFoodSource = false;
 			}
-			if (foodSourceFound)
-			{	// Early out if we found a collision
-				break;
-			}
-		}
+		});
 	}
+}
 
-	if (CollidingWithHive(mParentHive))
-	{
-		SetColor(Bee::ALERT_COLOR);
-	}
+void EmployedBee::GenerateNewTarget()
+{
+	uniform_real_distribution<float> distribution(-500.0f, 500.0f);
+	sf::Vector2f offset(distribution(mGenerator), distribution(mGenerator));
+	Target() = Position() + offset;
 }
 
-void EmployedBee::UpdatePosition(const sf::Vector2f& position, const float& rotation)
+FoodSource* EmployedBee::PairedFoodSource() const
 {
-	DetectStructureCollisions();
-	mPosition = position;
-	mBody.setPosition(sf::Vector2f(mPosition.x - BodyRadius, mPosition.y - BodyRadius));
-	mFace.setPosition(mPosition.x, mPosition.y);
-	auto rotationAngle = rotation * (180.0f / PI);
-	mFace.setRotation(rotationAngle);
+	return FoodSourceManager::GetInstance()->FindFoodSource(mPairedFoodSource);
 }
 
-void EmployedBee::GenerateNewTarget()
+FoodSource* EmployedBee::FindUnclaimedFoodSource() const
 {
-	uniform_real_distribution<float> distribution(-500.0f, 500.0f);
-	sf::Vector2f offset(distribution(mGenerator), distribution(mGenerator));
-	mTarget = mPosition + offset;
+	// Food sources register in the cell of their top left corner, so the search box reaches a full food source
+	// further than the detection range in every direction
+	auto reach = FoodSource::DetectionRadius + BodyRadius;
+	sf::Vector2f margin(reach + FoodSource::STANDARD_WIDTH, reach + FoodSource::STANDARD_HEIGHT);
+
+	FoodSource* result = nullptr;
+	CollisionGrid::GetInstance()->QueryRegion(Position() - margin, Position() + margin, [this, &result](const CollisionNode& node)
+	{
+		auto& foodSources = node.FoodSources();
+		for (auto iter = foodSources.begin(); iter != foodSources.end(); ++iter)
+		{	// Prefer the earliest spawned source so the choice does not depend on which cell was visited first
+			if (result != nullptr && result->GetHandle() < (*iter)->GetHandle())
+			{
+				continue;
+			}
+			if (DetectingFoodSource(*(*iter)) && !(*iter)->ContainsRegisteredHive(&mParentHive))
+			{
+				result = (*iter);
+			}
+		}
+		return false;
+	});
+	return result;
 }
@@ -2,11 +2,6 @@
 #include "Bee.h"
 
 
-namespace sf 
-{
-	class RenderWindow;
-}
-
 class EmployedBee : public Bee
 {
 
@@ -35,16 +30,9 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
-
-	/**
-	 * Render method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
-	 */
-	void Render(sf::RenderWindow& window) const override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 *  Toggles the flow field visualization for the wandering algorithm of the scouting state
@@ -57,12 +45,17 @@ public:
 	 */
 	void SetFlowFieldOctaveCount(const std::uint32_t& octaveCount);
 
-protected:
+#pragma region State Steps
 
-	/**
-	* Populates all of the function pointers into the function map
-	*/
-	void PopulateFunctionMaps() override;
+	// A full update for a bee already known to be in the named state. BeeManager buckets employees by state and
+	// calls these from one loop per state, so no per-bee dispatch is needed
+	void StepScouting(const double& deltaTime);
+	void StepSeekingTarget(const double& deltaTime);
+	void StepHarvestingFood(const double& deltaTime);
+	void StepDeliveringFood(const double& deltaTime);
+	void StepDepositingFood(const double& deltaTime);
+
+#pragma endregion
 
 private:
 
@@ -73,51 +66,50 @@ private:
 
 	/**
 	 * Updates the bee during its scouting state
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void UpdateScouting(sf::RenderWindow& window, const float& deltaTime);
+	void UpdateScouting(const float& deltaTime);
 
 	/**
 	 * Updates the bee during its seeking target state
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void UpdateSeekingTarget(sf::RenderWindow& window, const float& deltaTime);
+	void UpdateSeekingTarget(const float& deltaTime);
 
 	/**
 	 * Updates the bee during its harvesting food state
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void UpdateHarvestingFood(sf::RenderWindow& window, const float& deltaTime);
+	void UpdateHarvestingFood(const float& deltaTime);
 
 	/**
 	 * Updates the bee during its delivering food state
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void UpdateDeliveringFood(sf::RenderWindow& window, const float& deltaTime);
+	void UpdateDeliveringFood(const float& deltaTime);
 
 	/**
 	 * Updates the bee during its depositing food state
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void UpdateDepositingFood(sf::RenderWindow& window, const float& deltaTime);
+	void UpdateDepositingFood(const float& deltaTime);
+
+	void GenerateNewTarget();
 
 	/**
-	 * Updates the bees position
-	 * @Param window: The window that the simulation is being rendered to
-	 * @Param deltaTime: The time since the last Update call
+	 * Searches the collision cells within detection range of the bee for a food source its hive has not claimed yet
+	 * @Return: The earliest spawned unclaimed food source the bee is detecting, or nullptr if there is none
 	 */
-	void UpdatePosition(const sf::Vector2f& position, const float& rotation);
+	FoodSource* FindUnclaimedFoodSource() const;
 
-	void GenerateNewTarget();
+	/**
+	 * Resolves the handle of the food source this employee has claimed for its hive
+	 * @Return: The paired food source, or nullptr if the employee is not paired
+	 */
+	FoodSource* PairedFoodSource() const;
 
-	class FoodSource* mPairedFoodSource;
+	Handle<FoodSource> mPairedFoodSource;
 	bool mDisplayFlowField;
-	sf::VertexArray mLineToFoodSource;
 	std::pair<float, float> mFoodSourceData;
 	bool mAbandoningFoodSource;
 	sf::Vector2f mVelocity;
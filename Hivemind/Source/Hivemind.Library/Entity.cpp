@@ -13,6 +13,22 @@ float Entity::DistanceBetween(const sf::Vector2f& position_1, const sf::Vector2f
 	return sqrt((xDif * xDif) + (yDif * yDif));
 }
 
+float Entity::DistanceSquaredBetween(const sf::Vector2f& position_1, const sf::Vector2f& position_2)
+{
+	auto xDif = position_1.x - position_2.x;
+	auto yDif = position_1.y - position_2.y;
+	return (xDif * xDif) + (yDif * yDif);
+}
+
+void Entity::Render(sf::RenderWindow& window) const
+{
+	UNREFERENCED_PARAMETER(window);
+}
+
+void Entity::UpdatePresentation()
+{
+}
+
 void Entity::SetPosition(const sf::Vector2f& position)
 {
 	mPosition = position;
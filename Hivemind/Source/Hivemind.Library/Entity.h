@@ -32,16 +32,22 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	virtual void Update(sf::RenderWindow& window, const double& deltaTime) = 0;
+	virtual void Update(const double& deltaTime) = 0;
 
 	/**
-	 * Render method called by the main game loop
+	 * Render method called by the main game loop. Entities drawn by the world renderer do not override it
 	 * @Param window: The window that the simulation is being rendered to
 	 */
-	virtual void Render(sf::RenderWindow& window) const = 0;
+	virtual void Render(sf::RenderWindow& window) const;
+
+	/**
+	 * Refreshes render-only state, such as shape transforms, colors and labels, from the simulation state. Called just
+	 * before an entity draws itself. World snapshots do not call it, so it is skipped for every entity in a headless
+	 * run and whenever the world renderer draws. The simulation must never read anything written here
+	 */
+	virtual void UpdatePresentation();
 
 	/**
 	 * Computes the distance between the position of two entities
@@ -51,6 +57,15 @@ public:
 	 */
 	static float DistanceBetween(const sf::Vector2f& position_1, const sf::Vector2f& position_2);
 
+	/**
+	 * Calculates the squared distance between two vectors. Cheaper than DistanceBetween for comparisons against a
+	 * known range, since the range can be squared once instead of taking a root per test
+	 * @Param position_1: The position of the first entity
+	 * @Param position_2: The position of the second entity
+	 * @Return: A float representing the square of the number of pixels between the two vectors
+	 */
+	static float DistanceSquaredBetween(const sf::Vector2f& position_1, const sf::Vector2f& position_2);
+
 	/**
 	 * Mutator method for the entity's position
 	 * @Param position: The position that the entity is being moved to
@@ -61,7 +76,7 @@ public:
 	 * Accessor method for the entity's position
 	 * @Return: The entity's position
 	 */
-	const sf::Vector2f& GetPosition() const;
+	virtual const sf::Vector2f& GetPosition() const;
 
 	/**
 	 * Determines if the entity has been marked for deletion
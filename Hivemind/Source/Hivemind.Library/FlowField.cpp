@@ -4,9 +4,9 @@
 
 using namespace std;
 
-FlowField::FlowField(const sf::Vector2f& position):
+FlowField::FlowField(const sf::Vector2f& position, const RandomStream& stream):
 	Entity(position, sf::Color(100, 100, 100), sf::Color(100, 100, 100)),
-	mImage(), mSprite(), mTexture(), mOctaveCount(8)
+	mImage(), mSprite(), mTexture(), mOctaveCount(8), mGenerator(stream)
 {
 	mValues = new sf::Uint8*[mFieldDimensions.x];
 	for (int i = 0; i < mFieldDimensions.x; i++)
@@ -38,7 +38,7 @@ FlowField::~FlowField()
 }
 
 FlowField::FlowField(const FlowField& rhs):
-	Entity(rhs), mImage(), mSprite(), mTexture(), mOctaveCount(rhs.mOctaveCount)
+	Entity(rhs), mImage(), mSprite(), mTexture(), mOctaveCount(rhs.mOctaveCount), mGenerator(rhs.mGenerator)
 {
 	mValues = new sf::Uint8*[mFieldDimensions.x];
 	for (int i = 0; i < mFieldDimensions.x; i++)
@@ -68,13 +68,13 @@ FlowField& FlowField::operator=(const FlowField& rhs)
 	}
 
 	mImage = rhs.mImage;
+	mGenerator = rhs.mGenerator;
 
 	return (*this);
 }
 
-void FlowField::Update(sf::RenderWindow& window, const double& deltaTime)
+void FlowField::Update(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
 	UNREFERENCED_PARAMETER(deltaTime);
 	
 }
@@ -98,7 +98,8 @@ bool FlowField::CollidingWith(const sf::Vector2f& position) const
 
 void FlowField::GenerateNewField()
 {
-	PerlinNoise noise;
+	// Each regeneration forks a fresh stream so a field never repeats its previous noise
+	PerlinNoise noise(mGenerator.Fork(mGenerator()));
 	auto initialNoiseMap = noise.GenerateWhiteNoise(mFieldDimensions);
 	auto perlinNoise = noise.GeneratePerlinNoise(initialNoiseMap, mFieldDimensions, mOctaveCount);
 
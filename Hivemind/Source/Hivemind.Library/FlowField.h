@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include "RandomStream.h"
 
 
 class FlowField : public Entity
@@ -13,8 +14,9 @@ public:
 	/**
 	 * Constructor
 	 * @param position: The positio of the flow field
+	 * @Param stream: The random stream the field's noise is generated from
 	 */
-	explicit FlowField(const sf::Vector2f& position);
+	explicit FlowField(const sf::Vector2f& position, const RandomStream& stream = RandomStream());
 
 	~FlowField();
 
@@ -30,10 +32,9 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 * Render method called by the main game loop
@@ -86,6 +87,7 @@ private:
 	sf::Texture mTexture;
 	sf::Uint8** mValues;
 	std::uint32_t mOctaveCount;
+	RandomStream mGenerator;
 
 };
 
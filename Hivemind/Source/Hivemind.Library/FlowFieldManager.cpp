@@ -4,10 +4,9 @@
 
 FlowFieldManager* FlowFieldManager::sInstance = nullptr;
 
-FlowFieldManager::FlowFieldManager()
+FlowFieldManager::FlowFieldManager() :
+	mGenerator(World::GetInstance()->CreateStream(RandomStream::FlowField))
 {
-	std::random_device device;
-	mGenerator = std::default_random_engine(device());
 }
 
 FlowFieldManager::~FlowFieldManager()
@@ -39,6 +38,6 @@ void FlowFieldManager::Init()
 {
 	for (int i = 0; i < 100; i++)
 	{
-		mFlowFields.push_back(new FlowField(sf::Vector2f()));
+		mFlowFields.push_back(new FlowField(sf::Vector2f(), mGenerator.Fork(i)));
 	}
 }
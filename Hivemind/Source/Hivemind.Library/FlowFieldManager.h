@@ -48,7 +48,7 @@ private:
 	void Init();
 
 	std::vector<FlowField*> mFlowFields;
-	std::default_random_engine mGenerator;
+	RandomStream mGenerator;
 
 };
 
@@ -30,8 +30,14 @@ FontManager* FontManager::GetInstance()
 
 void FontManager::Init()
 {
+	// Nothing is ever drawn in a headless run, so there is no need for the font file to be present
+	if (World::GetInstance()->IsHeadless())
+	{
+		return;
+	}
+
 	if (!mHack.loadFromFile("Hack-Regular.ttf"))
 	{
-		throw new std::exception("Error loading font file");
+		throw std::runtime_error("Error loading font file");
 	}
 }
\ No newline at end of file
@@ -10,21 +10,12 @@ float FoodSource::DetectionRadius = 400.0f;
 
 FoodSource::FoodSource(const sf::Vector2f& position) :
 	Entity(position, sf::Color(196, 196, 196), sf::Color(32, 128, 32)), mDimensions(STANDARD_WIDTH, STANDARD_HEIGHT), mBody(mDimensions),
-	mMaxFoodAmount(10000.0f), mFoodAmount(mMaxFoodAmount), mText(), mPairedWithEmployee(false), mRegisteredHives()
+	mMaxFoodAmount(10000.0f), mFoodAmount(mMaxFoodAmount), mPairedWithEmployee(false), mRegisteredHives(), mHandle()
 {
 	mBody.setPosition(mPosition);
 	mBody.setOutlineThickness(14);
 	mBody.setOutlineColor(mOutlineColor);
 	mBody.setFillColor(mFillColor);
-
-	mText.setFont(FontManager::GetInstance()->Hack());
-	mText.setCharacterSize(16);
-	mText.setOutlineColor(sf::Color::White);
-	mText.setFillColor(sf::Color::White);
-	std::stringstream ss;
-	ss << "Food: " << mFoodAmount;
-	mText.setString(ss.str());
-	mText.setPosition(mPosition.x + 30, mPosition.y);
 }
 
 float FoodSource::TakeFood(const float amount)
@@ -50,35 +41,27 @@ bool FoodSource::IsViable() const
 	return mFoodAmount > 0.0f;
 }
 
-void FoodSource::Update(sf::RenderWindow& window, const double& deltaTime)
+void FoodSource::Update(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
 	UNREFERENCED_PARAMETER(deltaTime);
 
-	if (mCollisionNode != nullptr && !mCollisionNode->ContainsPoint(mPosition))
-	{	// If we haev a collision node and we leave it, invalidate the pointer
-		mCollisionNode->UnregisterFoodSource(this);
-		mCollisionNode = nullptr;
-	}
-
-	if (mCollisionNode == nullptr)
-	{	// If the collision node is invalidated, get a new one and register to it
-		mCollisionNode = CollisionGrid::GetInstance()->CollisionNodeFromPosition(mPosition);
-		mCollisionNode->RegisterFoodSource(this);
-	}
-
-	mBody.setFillColor(sf::Color(32, 32 + 96 * (mFoodAmount / mMaxFoodAmount), 32));
+	RefreshCollisionNode();
+}
 
-	std::stringstream ss;
-	ss << "Food: " << mFoodAmount;
-	mText.setString(ss.str());
-	mText.setPosition(mPosition.x + 30, mPosition.y);
+void FoodSource::AddToSnapshot(WorldSnapshot& snapshot) const
+{
+	WorldSnapshot::FoodSourceState state;
+	state.mId = (static_cast<uint64_t>(mHandle.GetGeneration()) << 32) | mHandle.GetIndex();
+	state.mPosition = mPosition;
+	state.mDimensions = mDimensions;
+	state.mFoodAmount = mFoodAmount;
+	state.mMaxFoodAmount = mMaxFoodAmount;
+	snapshot.AddFoodSource(state);
 }
 
 void FoodSource::Render(sf::RenderWindow& window) const
 {
 	window.draw(mBody);
-	window.draw(mText);
 }
 
 float FoodSource::GetFoodAmount() const
@@ -143,3 +126,23 @@ bool FoodSource::ContainsRegisteredHive(Hive* const hive) const
 
 	return result;
 }
+
+const Handle<FoodSource>& FoodSource::GetHandle() const
+{
+	return mHandle;
+}
+
+void FoodSource::RefreshCollisionNode()
+{
+	if (mCollisionNode != nullptr && !mCollisionNode->ContainsPoint(mPosition))
+	{	// If we haev a collision node and we leave it, invalidate the pointer
+		mCollisionNode->UnregisterFoodSource(this);
+		mCollisionNode = nullptr;
+	}
+
+	if (mCollisionNode == nullptr)
+	{	// If the collision node is invalidated, get a new one and register to it
+		mCollisionNode = CollisionGrid::GetInstance()->CollisionNodeFromPosition(mPosition);
+		mCollisionNode->RegisterFoodSource(this);
+	}
+}
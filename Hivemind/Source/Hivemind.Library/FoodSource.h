@@ -1,7 +1,10 @@
 #pragma once
 #include "Entity.h"
+#include "Handle.h"
 
 
+class WorldSnapshot;
+
 class FoodSource : public Entity
 {
 
@@ -68,10 +71,9 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 * Render method called by the main game loop
@@ -79,6 +81,12 @@ public:
 	 */
 	void Render(sf::RenderWindow& window) const override;
 
+	/**
+	 * Copies the food source's handle, position and remaining food into a snapshot of the world
+	 * @Param snapshot: The snapshot being captured, whose current cell is the one the food source is registered in
+	 */
+	void AddToSnapshot(WorldSnapshot& snapshot) const;
+
 	/**
 	 * Accessor for the amount of food that is currently stored
 	 * @Return: The amount of food stored in the source
@@ -134,16 +142,29 @@ public:
 	 */
 	bool ContainsRegisteredHive(Hive* const hive) const;
 
+	/**
+	 * Accessor method for the handle the FoodSourceManager issued for this food source
+	 * @Return: The food source's handle. Null if the food source was not spawned by the manager
+	 */
+	const Handle<FoodSource>& GetHandle() const;
+
 private:
 
+	friend class FoodSourceManager;
+
+	/**
+	 * Registers the food source with the collision node under its position, moving it if it has left its old node
+	 */
+	void RefreshCollisionNode();
+
 	// Fields
 	sf::Vector2f mDimensions;
 	sf::RectangleShape mBody;
 	float mMaxFoodAmount;
 	float mFoodAmount;
-	sf::Text mText;
 	bool mPairedWithEmployee;
 	std::vector<Hive*> mRegisteredHives;
+	Handle<FoodSource> mHandle;
 
 };
 
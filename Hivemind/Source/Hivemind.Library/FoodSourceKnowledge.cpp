@@ -0,0 +1,217 @@
+#include "pch.h"
+#include "FoodSourceKnowledge.h"
+
+
+using namespace std;
+
+const uint32_t FoodSourceKnowledge::NO_ROW = UINT32_MAX;
+
+FoodSourceKnowledge::FoodSourceKnowledge() :
+	mRows(), mFoodSources(), mYields(), mDistances(), mYieldRange({ 0.0f, 0.0f, 0.0f }),
+	mDistanceRange({ 0.0f, 0.0f, 0.0f }), mYieldRangeStale(false), mDistanceRangeStale(false)
+{
+}
+
+void FoodSourceKnowledge::Update(const Handle<FoodSource>& foodSource, const float& yield, const float& distance)
+{
+	assert(!foodSource.IsNull());
+
+	auto slot = foodSource.GetIndex();
+	if (slot >= mRows.size())
+	{
+		mRows.resize(slot + 1, NO_ROW);
+	}
+
+	auto row = mRows[slot];
+	if (row != NO_ROW && mFoodSources[row] != foodSource)
+	{	// The slot has been reused by a newer food source, so the old row describes something that no longer exists
+		auto stale = mFoodSources[row];
+		Remove(stale);
+		row = NO_ROW;
+	}
+
+	if (row == NO_ROW)
+	{
+		mRows[slot] = static_cast<uint32_t>(mFoodSources.size());
+		mFoodSources.push_back(foodSource);
+		mYields.push_back(yield);
+		mDistances.push_back(distance);
+		AdjustRange(mYieldRange, mYieldRangeStale, 0.0f, yield, mFoodSources.size() == 1);
+		AdjustRange(mDistanceRange, mDistanceRangeStale, 0.0f, distance, mFoodSources.size() == 1);
+		return;
+	}
+
+	auto previousYield = mYields[row];
+	auto previousDistance = mDistances[row];
+	mYields[row] = yield;
+	mDistances[row] = distance;
+	AdjustRange(mYieldRange, mYieldRangeStale, previousYield, yield, false);
+	AdjustRange(mDistanceRange, mDistanceRangeStale, previousDistance, distance, false);
+}
+
+void FoodSourceKnowledge::Remove(const Handle<FoodSource>& foodSource)
+{
+	auto row = FindRow(foodSource);
+	if (row == NO_ROW)
+	{
+		return;
+	}
+
+	RetractRange(mYieldRange, mYieldRangeStale, mYields[row]);
+	RetractRange(mDistanceRange, mDistanceRangeStale, mDistances[row]);
+
+	// Move the last row into the hole so the rows stay packed
+	auto last = static_cast<uint32_t>(mFoodSources.size() - 1);
+	if (row != last)
+	{
+		mFoodSources[row] = mFoodSources[last];
+		mYields[row] = mYields[last];
+		mDistances[row] = mDistances[last];
+		mRows[mFoodSources[row].GetIndex()] = row;
+	}
+
+	mRows[foodSource.GetIndex()] = NO_ROW;
+	mFoodSources.pop_back();
+	mYields.pop_back();
+	mDistances.pop_back();
+
+	if (mFoodSources.empty())
+	{
+		mYieldRange = { 0.0f, 0.0f, 0.0f };
+		mDistanceRange = { 0.0f, 0.0f, 0.0f };
+		mYieldRangeStale = false;
+		mDistanceRangeStale = false;
+	}
+}
+
+void FoodSourceKnowledge::Clear()
+{
+	// Only the slots that hold a row need resetting, which keeps clearing proportional to what was known
+	for (auto iter = mFoodSources.begin(); iter != mFoodSources.end(); ++iter)
+	{
+		mRows[iter->GetIndex()] = NO_ROW;
+	}
+
+	mFoodSources.clear();
+	mYields.clear();
+	mDistances.clear();
+	mYieldRange = { 0.0f, 0.0f, 0.0f };
+	mDistanceRange = { 0.0f, 0.0f, 0.0f };
+	mYieldRangeStale = false;
+	mDistanceRangeStale = false;
+}
+
+bool FoodSourceKnowledge::Contains(const Handle<FoodSource>& foodSource) const
+{
+	return FindRow(foodSource) != NO_ROW;
+}
+
+uint32_t FoodSourceKnowledge::Size() const
+{
+	return static_cast<uint32_t>(mFoodSources.size());
+}
+
+const Handle<FoodSource>& FoodSourceKnowledge::GetFoodSource(const uint32_t& row) const
+{
+	assert(row < mFoodSources.size());
+	return mFoodSources[row];
+}
+
+float FoodSourceKnowledge::GetYield(const uint32_t& row) const
+{
+	assert(row < mYields.size());
+	return mYields[row];
+}
+
+float FoodSourceKnowledge::GetDistance(const uint32_t& row) const
+{
+	assert(row < mDistances.size());
+	return mDistances[row];
+}
+
+const FoodSourceKnowledge::Range& FoodSourceKnowledge::GetYieldRange() const
+{
+	if (mYieldRangeStale)
+	{
+		RefreshRange(mYieldRange, mYieldRangeStale, mYields);
+	}
+
+	return mYieldRange;
+}
+
+const FoodSourceKnowledge::Range& FoodSourceKnowledge::GetDistanceRange() const
+{
+	if (mDistanceRangeStale)
+	{
+		RefreshRange(mDistanceRange, mDistanceRangeStale, mDistances);
+	}
+
+	return mDistanceRange;
+}
+
+uint32_t FoodSourceKnowledge::FindRow(const Handle<FoodSource>& foodSource) const
+{
+	auto slot = foodSource.GetIndex();
+	if (foodSource.IsNull() || slot >= mRows.size())
+	{
+		return NO_ROW;
+	}
+
+	auto row = mRows[slot];
+	return (row != NO_ROW && mFoodSources[row] == foodSource) ? row : NO_ROW;
+}
+
+void FoodSourceKnowledge::AdjustRange(Range& range, bool& stale, const float& previous, const float& value,
+	const bool& isNew)
+{
+	if (isNew && mFoodSources.size() == 1)
+	{	// The first row defines the range on its own
+		range = { value, value, value };
+		return;
+	}
+
+	range.mSum += isNew ? value : (value - previous);
+
+	if (stale)
+	{	// The range will be rescanned anyway
+		return;
+	}
+
+	if (!isNew && ((previous == range.mMinimum && value > previous) || (previous == range.mMaximum && value < previous)))
+	{	// An extreme moved inward, so some other row may now hold it
+		stale = true;
+		return;
+	}
+
+	range.mMinimum = min(range.mMinimum, value);
+	range.mMaximum = max(range.mMaximum, value);
+}
+
+void FoodSourceKnowledge::RetractRange(Range& range, bool& stale, const float& value)
+{
+	range.mSum -= value;
+
+	if (value == range.mMinimum || value == range.mMaximum)
+	{
+		stale = true;
+	}
+}
+
+void FoodSourceKnowledge::RefreshRange(Range& range, bool& stale, const vector<float>& column) const
+{
+	stale = false;
+	if (column.empty())
+	{
+		range = { 0.0f, 0.0f, 0.0f };
+		return;
+	}
+
+	// The sum is recomputed alongside the extremes so rounding drift from incremental updates does not accumulate
+	range = { column.front(), column.front(), 0.0f };
+	for (auto iter = column.begin(); iter != column.end(); ++iter)
+	{
+		range.mMinimum = min(range.mMinimum, *iter);
+		range.mMaximum = max(range.mMaximum, *iter);
+		range.mSum += *iter;
+	}
+}
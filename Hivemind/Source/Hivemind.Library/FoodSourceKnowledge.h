@@ -0,0 +1,166 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Handle.h"
+
+
+class FoodSource;
+
+/**
+ * What a hive has learned from its scouts about each food source: the food it had left when last visited and how far
+ * it is from the hive. Rows are packed into parallel arrays so a waggle dance streams through them in order, and a
+ * sparse index keyed by the food source's handle slot makes lookups, updates and removals O(1).
+ *
+ * The range and sum of both columns are kept up to date as rows change. Sums and any range that a change widens are
+ * adjusted in place. Only when the row holding a minimum or maximum moves inward, or is removed, is that range
+ * marked stale and rescanned, once, the next time it is read
+ */
+class FoodSourceKnowledge
+{
+
+public:
+
+	/**
+	 * The smallest and largest value in a column, along with its sum
+	 */
+	struct Range
+	{
+		float mMinimum;
+		float mMaximum;
+		float mSum;
+	};
+
+#pragma region Construction/Copy/Assignment
+
+	FoodSourceKnowledge();
+
+	~FoodSourceKnowledge() = default;
+
+	FoodSourceKnowledge(const FoodSourceKnowledge& rhs) = default;
+
+	FoodSourceKnowledge& operator=(const FoodSourceKnowledge& rhs) = default;
+
+	FoodSourceKnowledge(FoodSourceKnowledge&& rhs) = default;
+
+	FoodSourceKnowledge& operator=(FoodSourceKnowledge&& rhs) = default;
+
+#pragma endregion
+
+	/**
+	 * Records the latest report about a food source, adding a row for it if it is not known yet
+	 * @Param foodSource: The food source being reported on
+	 * @Param yield: The amount of food the source had left
+	 * @Param distance: The distance from the hive to the source
+	 */
+	void Update(const Handle<FoodSource>& foodSource, const float& yield, const float& distance);
+
+	/**
+	 * Forgets a food source. Unknown or stale handles are ignored
+	 * @Param foodSource: The food source being forgotten
+	 */
+	void Remove(const Handle<FoodSource>& foodSource);
+
+	/**
+	 * Forgets every food source, keeping the storage for the next round of reports
+	 */
+	void Clear();
+
+	/**
+	 * Determines if a food source has been reported and not forgotten since
+	 * @Param foodSource: The food source being looked up
+	 * @Return: True if the table holds a row for the food source
+	 */
+	bool Contains(const Handle<FoodSource>& foodSource) const;
+
+	/**
+	 * Accessor method for the number of known food sources
+	 * @Return: The number of rows in the table
+	 */
+	std::uint32_t Size() const;
+
+	/**
+	 * Accessor method for the food source a row describes. Rows are packed, so removing a food source may move the
+	 * last row into its place
+	 * @Param row: A row index less than Size()
+	 * @Return: The handle of the food source the row describes
+	 */
+	const Handle<FoodSource>& GetFoodSource(const std::uint32_t& row) const;
+
+	/**
+	 * Accessor method for the yield a row last reported
+	 * @Param row: A row index less than Size()
+	 * @Return: The amount of food the source had left
+	 */
+	float GetYield(const std::uint32_t& row) const;
+
+	/**
+	 * Accessor method for the distance a row last reported
+	 * @Param row: A row index less than Size()
+	 * @Return: The distance from the hive to the source
+	 */
+	float GetDistance(const std::uint32_t& row) const;
+
+	/**
+	 * Accessor method for the range of reported yields
+	 * @Return: The minimum, maximum and sum of the yield column. All zero if the table is empty
+	 */
+	const Range& GetYieldRange() const;
+
+	/**
+	 * Accessor method for the range of reported distances
+	 * @Return: The minimum, maximum and sum of the distance column. All zero if the table is empty
+	 */
+	const Range& GetDistanceRange() const;
+
+private:
+
+	const static std::uint32_t NO_ROW;
+
+	/**
+	 * Finds the row holding a food source
+	 * @Param foodSource: The food source being looked up
+	 * @Return: The row index, or NO_ROW if the food source is not known
+	 */
+	std::uint32_t FindRow(const Handle<FoodSource>& foodSource) const;
+
+	/**
+	 * Folds a value entering a column into that column's range
+	 * @Param range: The range of the column
+	 * @Param stale: Set when the range can no longer be adjusted in place
+	 * @Param previous: The value the row held before, ignored if isNew is true
+	 * @Param value: The value the row holds now
+	 * @Param isNew: True if the row did not exist before
+	 */
+	void AdjustRange(Range& range, bool& stale, const float& previous, const float& value, const bool& isNew);
+
+	/**
+	 * Takes a value leaving a column out of that column's range
+	 * @Param range: The range of the column
+	 * @Param stale: Set when the value was one of the column's extremes
+	 * @Param value: The value being removed
+	 */
+	void RetractRange(Range& range, bool& stale, const float& value);
+
+	/**
+	 * Rescans a column to rebuild a range that was marked stale
+	 * @Param range: The range being rebuilt
+	 * @Param stale: Cleared once the range is rebuilt
+	 * @Param column: The values in the column
+	 */
+	void RefreshRange(Range& range, bool& stale, const std::vector<float>& column) const;
+
+	// Sparse index from handle slot to row
+	std::vector<std::uint32_t> mRows;
+
+	// Packed rows
+	std::vector<Handle<FoodSource>> mFoodSources;
+	std::vector<float> mYields;
+	std::vector<float> mDistances;
+
+	// Refreshed lazily by the const accessors, so they are mutable
+	mutable Range mYieldRange;
+	mutable Range mDistanceRange;
+	mutable bool mYieldRangeStale;
+	mutable bool mDistanceRangeStale;
+
+};
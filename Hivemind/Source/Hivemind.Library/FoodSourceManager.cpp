@@ -4,7 +4,8 @@
 
 FoodSourceManager* FoodSourceManager::sInstance = nullptr;
 
-FoodSourceManager::FoodSourceManager()
+FoodSourceManager::FoodSourceManager() :
+	mFoodSources(), mHandles()
 {
 }
 
@@ -21,6 +22,7 @@ FoodSourceManager::~FoodSourceManager()
 {
 	for (auto iter = mFoodSources.begin(); iter != mFoodSources.end(); ++iter)
 	{
+		mHandles.Release((*iter)->mHandle);
 		delete (*iter);
 	}
 	mFoodSources.clear();
@@ -28,22 +30,18 @@ FoodSourceManager::~FoodSourceManager()
 
 void FoodSourceManager::SpawnFoodSource(const sf::Vector2f& position)
 {
-	mFoodSources.push_back(new FoodSource(position));
+	auto foodSource = new FoodSource(position);
+	foodSource->mHandle = mHandles.Issue(foodSource);
+	// Scouts find food sources through the collision grid, so they must be visible before their first update
+	foodSource->RefreshCollisionNode();
+	mFoodSources.push_back(foodSource);
 }
 
-void FoodSourceManager::Update(sf::RenderWindow& window, const float& deltaTime)
+void FoodSourceManager::Update(const float& deltaTime)
 {
 	for (auto iter = mFoodSources.begin(); iter != mFoodSources.end(); ++iter)
 	{
-		(*iter)->Update(window, deltaTime);
-	}
-}
-
-void FoodSourceManager::Render(sf::RenderWindow& window)
-{
-	for (auto iter = mFoodSources.begin(); iter != mFoodSources.end(); ++iter)
-	{
-		(*iter)->Render(window);
+		(*iter)->Update(deltaTime);
 	}
 }
 
@@ -66,8 +64,13 @@ FoodSource& FoodSourceManager::GetFoodSource(const std::uint32_t& index)
 {
 	if (index >= mFoodSources.size())
 	{
-		throw std::exception("Index out of bounds");
+		throw std::out_of_range("Index out of bounds");
 	}
 
 	return *mFoodSources[index];
 }
+
+FoodSource* FoodSourceManager::FindFoodSource(const Handle<FoodSource>& handle) const
+{
+	return mHandles.Find(handle);
+}
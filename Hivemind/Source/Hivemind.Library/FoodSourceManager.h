@@ -40,16 +40,9 @@ public:
 
 	/**
 	 * Disseminates update calls to all food sources
-	 * @Param window: The screen which all food sources are being rendered to
 	 * @Param deltaTime: The time since last update call
 	 */
-	void Update(sf::RenderWindow& window, const float& deltaTime);
-
-	/**
-	 * Disseminates render calls to all food sources
-	 * @Param window: The screen which all food sources are being rendered to
-	 */
-	void Render(sf::RenderWindow& window);
+	void Update(const float& deltaTime);
 
 	/**
 	 * Accessor method for the size of the food source lsit
@@ -77,10 +70,18 @@ public:
 	 */
 	FoodSource& GetFoodSource(const std::uint32_t& index);
 
+	/**
+	 * Resolves a handle issued by this manager
+	 * @Param handle: The handle of the food source being looked up
+	 * @Return: A pointer to the food source, or nullptr if the handle is null or stale
+	 */
+	FoodSource* FindFoodSource(const Handle<FoodSource>& handle) const;
+
 private:
 
 	static FoodSourceManager* sInstance;
 	std::vector<FoodSource*> mFoodSources;
+	HandleTable<FoodSource> mHandles;
 
 };
 
@@ -8,19 +8,16 @@ Guard::Guard(const sf::Vector2f& position, Hive& hive) :
 	Bee(position, hive)
 {
 	mFillColor = sf::Color(128, 0, 0);
-	mBody.setFillColor(mFillColor);
 }
 
-void Guard::Update(sf::RenderWindow& window, const double& deltaTime)
+void Guard::Update(const double& deltaTime)
 {
-	Bee::Update(window, deltaTime);
+	Bee::Update(deltaTime);
 
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	float rotationAngle = rotationRadians * (180 / PI);
-	sf::Vector2f newPosition = mPosition;
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
+	sf::Vector2f newPosition = Position();
 
-	if (DistanceBetween(mTarget, mPosition) <= TARGET_RADIUS)
+	if (DistanceBetween(Target(), Position()) <= TARGET_RADIUS)
 	{
 		auto dimensions = mParentHive.GetDimensions();
 		uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x), static_cast<int>(dimensions.x));
@@ -30,26 +27,27 @@ void Guard::Update(sf::RenderWindow& window, const double& deltaTime)
 	}
 
 	newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 
-	DetectStructureCollisions();
-	mPosition = newPosition;
-	mBody.setPosition(sf::Vector2f(mPosition.x - BodyRadius, mPosition.y - BodyRadius));
-	mFace.setPosition(mPosition.x, mPosition.y);
-	mFace.setRotation(rotationAngle);
+	Position() = newPosition;
 
-	auto waspManager = WaspManager::GetInstance();
-	for (auto iter = waspManager->Begin(); iter != waspManager->End(); ++iter)
-	{
-		if ((*iter)->GetTargetHive() == &mParentHive && !(*iter)->MarkedForDelete() && 
-			DistanceBetween(mParentHive.GetCenterTarget(), (*iter)->GetPosition()) < mParentHive.GetDimensions().x)
+	Defer([this]()
+	{	// Each wasp can only be stung once, so guards must claim them one at a time
+		auto waspManager = WaspManager::GetInstance();
+		auto& threats = mParentHive.Threats();
+		for (auto iter = threats.begin(); iter != threats.end(); ++iter)
 		{
-			MarkForDelete();
-			(*iter)->MarkForDelete();
-			break;
+			auto wasp = waspManager->FindWasp(*iter);
+			if (wasp != nullptr && !wasp->MarkedForDelete() &&
+				DistanceBetween(mParentHive.GetCenterTarget(), wasp->GetPosition()) < mParentHive.GetDimensions().x)
+			{
+				MarkForDelete();
+				wasp->MarkForDelete();
+				break;
+			}
 		}
-	}
+	});
 }
 
 void Guard::Render(sf::RenderWindow& window) const
@@ -30,20 +30,14 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 * Render method called by the main game loop
 	 * @Param window: The window that the simulation is being rendered to
 	 */
 	void Render(sf::RenderWindow& window) const override;
-
-protected:
-
-	// Guards don't use state so we don't need to use the function map
-	void PopulateFunctionMaps() override {}
 };
 
@@ -0,0 +1,490 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * Weak reference to an entity issued by the entity's manager. A handle names a slot in the manager's HandleTable
+ * together with the generation of that slot when the handle was issued, so a handle to an entity that has since been
+ * destroyed resolves to nullptr instead of dangling, even once its slot has been reused
+ */
+template <typename T>
+class Handle
+{
+
+public:
+
+	/**
+	 * Constructor. Default constructed handles are null and never resolve
+	 */
+	Handle();
+
+	/**
+	 * Determines if the handle was ever issued
+	 * @Return: True if the handle is null. False otherwise, even if the entity it referred to has been destroyed
+	 */
+	bool IsNull() const;
+
+	/**
+	 * Accessor method for the slot the handle refers to
+	 * @Return: The index of the slot in the issuing HandleTable
+	 */
+	std::uint32_t GetIndex() const;
+
+	/**
+	 * Accessor method for the generation the handle was issued with
+	 * @Return: The generation of the slot at the time the handle was issued
+	 */
+	std::uint32_t GetGeneration() const;
+
+	bool operator==(const Handle& rhs) const;
+
+	bool operator!=(const Handle& rhs) const;
+
+	/**
+	 * Orders handles by slot, which for entities that are never destroyed is the order they were spawned in
+	 */
+	bool operator<(const Handle& rhs) const;
+
+private:
+
+	template <typename U>
+	friend class HandleTable;
+
+	const static std::uint32_t NULL_INDEX = UINT32_MAX;
+
+	Handle(const std::uint32_t& index, const std::uint32_t& generation);
+
+	std::uint32_t mIndex;
+	std::uint32_t mGeneration;
+
+};
+
+/**
+ * Maps handles to the current address of the entity they were issued for. Lookups are a bounds check, a generation
+ * check and one load. Released slots are kept on a free list threaded through the table itself, so issuing and
+ * releasing handles never allocates once the table has grown to the peak entity count
+ */
+template <typename T>
+class HandleTable
+{
+
+public:
+
+#pragma region Construction/Copy/Assignment
+
+	/**
+	 * Constructor
+	 * @Param initialCapacity: The number of slots reserved up front
+	 */
+	explicit HandleTable(const std::uint32_t& initialCapacity = 0);
+
+	~HandleTable() = default;
+
+	HandleTable(const HandleTable& rhs) = delete;
+
+	HandleTable& operator=(const HandleTable& rhs) = delete;
+
+	HandleTable(HandleTable&& rhs) = delete;
+
+	HandleTable& operator=(HandleTable&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Issues a handle for an entity, reusing a released slot if one is free
+	 * @Param object: The entity being referred to
+	 * @Return: A handle that resolves to the entity until it is released
+	 */
+	Handle<T> Issue(T* const object);
+
+	/**
+	 * Invalidates every copy of a handle and frees its slot for reuse
+	 * @Param handle: A handle previously issued by this table. Stale or null handles are ignored
+	 */
+	void Release(const Handle<T>& handle);
+
+	/**
+	 * Points a live handle at the new address of its entity, for when the entity is moved in memory
+	 * @Param handle: The handle being updated
+	 * @Param object: The entity's new address
+	 */
+	void Relocate(const Handle<T>& handle, T* const object);
+
+	/**
+	 * Resolves a handle to its entity
+	 * @Param handle: The handle being resolved
+	 * @Return: A pointer to the entity, or nullptr if the handle is null or the entity has been released
+	 */
+	T* Find(const Handle<T>& handle) const;
+
+	/**
+	 * Accessor method for the number of handles currently issued
+	 * @Return: The number of live entities in the table
+	 */
+	std::uint32_t GetLiveCount() const;
+
+private:
+
+	const static std::uint32_t NULL_INDEX = UINT32_MAX;
+
+	struct Slot
+	{
+		Slot() : mObject(nullptr), mGeneration(0), mNextFree(NULL_INDEX)
+		{
+		}
+
+		T* mObject;
+		std::uint32_t mGeneration;
+		std::uint32_t mNextFree;
+	};
+
+	std::vector<Slot> mSlots;
+	std::uint32_t mFreeList;
+	std::uint32_t mLiveCount;
+
+};
+
+/**
+ * Set of handles with constant time insertion, removal and membership tests. Members are packed into one array that
+ * can be walked in order, and a sparse array keyed by handle slot records where each member sits in it. Removing a
+ * member moves the last member into its place, so the order is deterministic but not the order of insertion
+ */
+template <typename T>
+class HandleSet
+{
+
+public:
+
+	typedef typename std::vector<Handle<T>>::const_iterator ConstIterator;
+
+#pragma region Construction/Copy/Assignment
+
+	HandleSet() = default;
+
+	~HandleSet() = default;
+
+	HandleSet(const HandleSet& rhs) = default;
+
+	HandleSet& operator=(const HandleSet& rhs) = default;
+
+	HandleSet(HandleSet&& rhs) = default;
+
+	HandleSet& operator=(HandleSet&& rhs) = default;
+
+#pragma endregion
+
+	/**
+	 * Adds a handle to the set. A stale member from an earlier generation of the same slot is replaced
+	 * @Param handle: The handle being added. Must not be null
+	 * @Return: True if the handle was added, false if it was already a member
+	 */
+	bool Insert(const Handle<T>& handle);
+
+	/**
+	 * Removes a handle from the set
+	 * @Param handle: The handle being removed. Handles that are not members are ignored
+	 * @Return: True if the handle was a member
+	 */
+	bool Remove(const Handle<T>& handle);
+
+	/**
+	 * Determines if a handle is in the set
+	 * @Param handle: The handle being looked up
+	 * @Return: True if the handle, including its generation, is a member
+	 */
+	bool Contains(const Handle<T>& handle) const;
+
+	/**
+	 * Visits every member once, in order, and keeps only those the visitor accepts. The survivors keep their relative
+	 * order, and the whole pass costs O(n) no matter how many members are dropped
+	 * @Param visitor: Called with each member. Returning false removes the member. The visitor must not modify the set
+	 */
+	template <typename Visitor>
+	void KeepIf(Visitor visitor);
+
+	/**
+	 * Removes every member, keeping the storage
+	 */
+	void Clear();
+
+	/**
+	 * Accessor method for the number of members
+	 * @Return: The number of handles in the set
+	 */
+	std::uint32_t Size() const;
+
+	/**
+	 * Determines if the set has no members
+	 * @Return: True if the set is empty
+	 */
+	bool IsEmpty() const;
+
+	/**
+	 * Accessor method for the start of the packed members
+	 * @Return: An iterator to the first member
+	 */
+	ConstIterator Begin() const;
+
+	/**
+	 * Accessor method for the end of the packed members
+	 * @Return: An iterator past the last member
+	 */
+	ConstIterator End() const;
+
+private:
+
+	const static std::uint32_t NOT_MEMBER = UINT32_MAX;
+
+	// Position of each slot's member in mMembers, or NOT_MEMBER
+	std::vector<std::uint32_t> mPositions;
+	std::vector<Handle<T>> mMembers;
+
+};
+
+template <typename T>
+const std::uint32_t Handle<T>::NULL_INDEX;
+
+template <typename T>
+const std::uint32_t HandleTable<T>::NULL_INDEX;
+
+template <typename T>
+const std::uint32_t HandleSet<T>::NOT_MEMBER;
+
+template <typename T>
+Handle<T>::Handle() :
+	mIndex(NULL_INDEX), mGeneration(0)
+{
+}
+
+template <typename T>
+bool Handle<T>::IsNull() const
+{
+	return mIndex == NULL_INDEX;
+}
+
+template <typename T>
+std::uint32_t Handle<T>::GetIndex() const
+{
+	return mIndex;
+}
+
+template <typename T>
+std::uint32_t Handle<T>::GetGeneration() const
+{
+	return mGeneration;
+}
+
+template <typename T>
+bool Handle<T>::operator==(const Handle& rhs) const
+{
+	return mIndex == rhs.mIndex && mGeneration == rhs.mGeneration;
+}
+
+template <typename T>
+bool Handle<T>::operator!=(const Handle& rhs) const
+{
+	return !(*this == rhs);
+}
+
+template <typename T>
+bool Handle<T>::operator<(const Handle& rhs) const
+{
+	return (mIndex != rhs.mIndex) ? (mIndex < rhs.mIndex) : (mGeneration < rhs.mGeneration);
+}
+
+template <typename T>
+Handle<T>::Handle(const std::uint32_t& index, const std::uint32_t& generation) :
+	mIndex(index), mGeneration(generation)
+{
+}
+
+template <typename T>
+HandleTable<T>::HandleTable(const std::uint32_t& initialCapacity) :
+	mSlots(), mFreeList(NULL_INDEX), mLiveCount(0)
+{
+	mSlots.reserve(initialCapacity);
+}
+
+template <typename T>
+Handle<T> HandleTable<T>::Issue(T* const object)
+{
+	assert(object != nullptr);
+
+	std::uint32_t index;
+	if (mFreeList != NULL_INDEX)
+	{
+		index = mFreeList;
+		mFreeList = mSlots[index].mNextFree;
+	}
+	else
+	{
+		index = static_cast<std::uint32_t>(mSlots.size());
+		mSlots.push_back(Slot());
+	}
+
+	auto& slot = mSlots[index];
+	slot.mObject = object;
+	slot.mNextFree = NULL_INDEX;
+	mLiveCount++;
+	return Handle<T>(index, slot.mGeneration);
+}
+
+template <typename T>
+void HandleTable<T>::Release(const Handle<T>& handle)
+{
+	if (Find(handle) == nullptr)
+	{
+		return;
+	}
+
+	auto& slot = mSlots[handle.mIndex];
+	slot.mObject = nullptr;
+	slot.mGeneration++;
+	slot.mNextFree = mFreeList;
+	mFreeList = handle.mIndex;
+	mLiveCount--;
+}
+
+template <typename T>
+void HandleTable<T>::Relocate(const Handle<T>& handle, T* const object)
+{
+	assert(Find(handle) != nullptr && object != nullptr);
+	mSlots[handle.mIndex].mObject = object;
+}
+
+template <typename T>
+T* HandleTable<T>::Find(const Handle<T>& handle) const
+{
+	if (handle.mIndex >= mSlots.size())
+	{
+		return nullptr;
+	}
+
+	const auto& slot = mSlots[handle.mIndex];
+	return (slot.mGeneration == handle.mGeneration) ? slot.mObject : nullptr;
+}
+
+template <typename T>
+std::uint32_t HandleTable<T>::GetLiveCount() const
+{
+	return mLiveCount;
+}
+
+template <typename T>
+bool HandleSet<T>::Insert(const Handle<T>& handle)
+{
+	assert(!handle.IsNull());
+
+	auto slot = handle.GetIndex();
+	if (slot >= mPositions.size())
+	{
+		mPositions.resize(slot + 1, NOT_MEMBER);
+	}
+
+	auto position = mPositions[slot];
+	if (position != NOT_MEMBER)
+	{
+		if (mMembers[position] == handle)
+		{
+			return false;
+		}
+
+		// The slot has been reused since its old member was added, so that member refers to nothing
+		mMembers[position] = handle;
+		return true;
+	}
+
+	mPositions[slot] = static_cast<std::uint32_t>(mMembers.size());
+	mMembers.push_back(handle);
+	return true;
+}
+
+template <typename T>
+bool HandleSet<T>::Remove(const Handle<T>& handle)
+{
+	if (!Contains(handle))
+	{
+		return false;
+	}
+
+	// Read the slot up front, as the handle may refer to a member that is about to be overwritten
+	auto slot = handle.GetIndex();
+	auto position = mPositions[slot];
+	auto last = mMembers.back();
+	mMembers[position] = last;
+	mPositions[last.GetIndex()] = position;
+	mPositions[slot] = NOT_MEMBER;
+	mMembers.pop_back();
+	return true;
+}
+
+template <typename T>
+bool HandleSet<T>::Contains(const Handle<T>& handle) const
+{
+	if (handle.IsNull() || handle.GetIndex() >= mPositions.size())
+	{
+		return false;
+	}
+
+	auto position = mPositions[handle.GetIndex()];
+	return position != NOT_MEMBER && mMembers[position] == handle;
+}
+
+template <typename T>
+template <typename Visitor>
+void HandleSet<T>::KeepIf(Visitor visitor)
+{
+	std::uint32_t survivors = 0;
+	for (std::uint32_t i = 0; i < mMembers.size(); ++i)
+	{
+		// Copied so the visitor sees the member even if it is overwritten by a survivor moving down
+		auto member = mMembers[i];
+		if (visitor(member))
+		{
+			mMembers[survivors] = member;
+			mPositions[member.GetIndex()] = survivors;
+			survivors++;
+		}
+		else
+		{
+			mPositions[member.GetIndex()] = NOT_MEMBER;
+		}
+	}
+	mMembers.resize(survivors);
+}
+
+template <typename T>
+void HandleSet<T>::Clear()
+{
+	for (auto iter = mMembers.begin(); iter != mMembers.end(); ++iter)
+	{
+		mPositions[iter->GetIndex()] = NOT_MEMBER;
+	}
+	mMembers.clear();
+}
+
+template <typename T>
+std::uint32_t HandleSet<T>::Size() const
+{
+	return static_cast<std::uint32_t>(mMembers.size());
+}
+
+template <typename T>
+bool HandleSet<T>::IsEmpty() const
+{
+	return mMembers.empty();
+}
+
+template <typename T>
+typename HandleSet<T>::ConstIterator HandleSet<T>::Begin() const
+{
+	return mMembers.begin();
+}
+
+template <typename T>
+typename HandleSet<T>::ConstIterator HandleSet<T>::End() const
+{
+	return mMembers.end();
+}
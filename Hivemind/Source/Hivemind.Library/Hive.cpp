@@ -4,39 +4,47 @@
 
 using namespace std;
 
-Hive::Hive(const sf::Vector2f& position) :
-	Entity(position, sf::Color(196, 196, 196), sf::Color(222, 147, 12)), mDimensions(STANDARD_WIDTH, STANDARD_HEIGHT), mBody(mDimensions),
-	mFoodAmount(5000.0f), mText(), mGenerator(), mWaggleDanceClock(), mWaggleDanceWaitPeriod(Bee::STANDARD_HARVESTING_DURATION), mWaggleDanceInProgress(false),
+const float Hive::STANDARD_WIDTH = 200.0f;
+const float Hive::STANDARD_HEIGHT = 200.0f;
+
+Hive::Hive(const sf::Vector2f& position, const uint32_t& id) :
+	Entity(position, sf::Color(196, 196, 196), sf::Color(222, 147, 12)), mDimensions(STANDARD_WIDTH, STANDARD_HEIGHT),
+	mFoodAmount(5000.0f), mId(id), mHandle(),
+	mGenerator(World::GetInstance()->CreateStream(RandomStream::Hive, id)), mBeeStream(World::GetInstance()->CreateStream(RandomStream::Bee, id)), mBirthCount(0),
+	mWaggleDanceStartTime(0.0), mWaggleDanceWaitPeriod(Bee::STANDARD_HARVESTING_DURATION), mWaggleDanceInProgress(false),
 	mStructuralComb(2000.0f), mHoneyComb(5000.0f), mBroodComb(550.0f),
-	mOnlookerCount(0), mEmployeeCount(0), mGuardCount(0), mQueenCount(0), mDroneCount(0),
-	mHUD(mPosition + sf::Vector2f(-(mDimensions.x / 2.0f), mDimensions.y + 30), sf::Vector2f(mDimensions.x * 2, 20),
-		mOnlookerCount, mEmployeeCount, mDroneCount, mGuardCount, mQueenCount, mStructuralComb, mHoneyComb, mBroodComb, mFoodAmount)
+	mOnlookerCount(0), mEmployeeCount(0), mGuardCount(0), mQueenCount(0), mDroneCount(0)
 {
-	std::random_device device;
-	mGenerator = std::default_random_engine(device());
-	mFoodSourceData.clear();
-	mBody.setPosition(mPosition);
-	mBody.setOutlineThickness(14);
-	mBody.setOutlineColor(mOutlineColor);
-	mBody.setFillColor(mFillColor);
-
-	mText.setPosition(mPosition.x - mText.getLocalBounds().width / 2, mPosition.y);
-	mText.setFont(FontManager::GetInstance()->Hack());
-	mText.setCharacterSize(16);
-	mText.setOutlineColor(sf::Color::White);
 }
 
 Hive::~Hive()
 {
-	mIdleBees.clear();
-	mFoodSourceData.clear();
+	mIdleBees.Clear();
+	mThreats.clear();
+	mFoodSources.Clear();
 }
 
-void Hive::Update(sf::RenderWindow& window, const double& deltaTime)
+void Hive::Update(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
 	UNREFERENCED_PARAMETER(deltaTime);
 
+	RefreshCollisionNode();
+
+	// Drop the wasps that have been destroyed, keeping the rest in the order they began their attack
+	auto waspManager = WaspManager::GetInstance();
+	mThreats.erase(remove_if(mThreats.begin(), mThreats.end(), [waspManager](const Handle<Wasp>& wasp)
+	{
+		return waspManager->FindWasp(wasp) == nullptr;
+	}), mThreats.end());
+
+//	std::stringstream ss;
+//	ss << "Food: " << mFoodAmount << endl << endl;
+//	mText.setString(ss.str());
+//	mText.setPosition(mPosition.x + 30, mPosition.y);
+}
+
+void Hive::RefreshCollisionNode()
+{
 	if (mCollisionNode != nullptr && !mCollisionNode->ContainsPoint(mPosition))
 	{	// If we haev a collision node and we leave it, invalidate the pointer
 		mCollisionNode->UnregisterHive(this);
@@ -48,20 +56,24 @@ void Hive::Update(sf::RenderWindow& window, const double& deltaTime)
 		mCollisionNode = CollisionGrid::GetInstance()->CollisionNodeFromPosition(mPosition);
 		mCollisionNode->RegisterHive(this);
 	}
-
-//	std::stringstream ss;
-//	ss << "Food: " << mFoodAmount << endl << endl;
-//	mText.setString(ss.str());
-//	mText.setPosition(mPosition.x + 30, mPosition.y);
-
-	mHUD.UpdateHUDValues();
 }
 
-void Hive::Render(sf::RenderWindow& window) const
+void Hive::AddToSnapshot(WorldSnapshot& snapshot) const
 {
-	window.draw(mBody);
-	window.draw(mText);
-	mHUD.Render(window);
+	WorldSnapshot::HiveState state;
+	state.mPosition = mPosition;
+	state.mDimensions = mDimensions;
+	state.mId = mId;
+	state.mOnlookerCount = mOnlookerCount;
+	state.mEmployeeCount = mEmployeeCount;
+	state.mDroneCount = mDroneCount;
+	state.mGuardCount = mGuardCount;
+	state.mQueenCount = mQueenCount;
+	state.mStructuralComb = mStructuralComb;
+	state.mHoneyComb = mHoneyComb;
+	state.mBroodComb = mBroodComb;
+	state.mFoodAmount = mFoodAmount;
+	snapshot.AddHive(state);
 }
 
 sf::Vector2f Hive::GetCenterTarget() const
@@ -96,163 +108,111 @@ float Hive::TakeFood(float foodAmount)
 
 void Hive::AddIdleBee(OnlookerBee* const bee)
 {
-	bool containsBee = false;
-
-	for (auto iter = mIdleBees.begin(); iter != mIdleBees.end(); ++iter)
-	{
-		if (*iter == bee)
-		{
-			containsBee = true;
-			break;
-		}
-	}
-
-	if (!containsBee)
-	{	// Only add the bee if it does not exist in the collection already
-		mIdleBees.push_back(bee);
-	}
+	mIdleBees.Insert(bee->GetHandle());
 }
 
 void Hive::RemoveIdleBee(OnlookerBee* const bee)
 {
-	for (auto iter = mIdleBees.begin(); iter != mIdleBees.end(); ++iter)
-	{
-		if (*iter == bee)
-		{	// If we encounter the bee, remove it. If not, no behavior
-			mIdleBees.erase(iter);
-			break;
-		}
-	}
+	mIdleBees.Remove(bee->GetHandle());
 }
 
-std::vector<OnlookerBee*>::iterator Hive::IdleBeesBegin()
+HandleSet<Bee>::ConstIterator Hive::IdleBeesBegin() const
 {
-	return mIdleBees.begin();
+	return mIdleBees.Begin();
 }
 
-std::vector<OnlookerBee*>::iterator Hive::IdleBeesEnd()
+HandleSet<Bee>::ConstIterator Hive::IdleBeesEnd() const
 {
-	return mIdleBees.end();
+	return mIdleBees.End();
 }
 
 void Hive::ValidateIdleBees()
 {
-	bool beeRemoved = true;
-	while (beeRemoved)
-	{	// Repeat until we look through all bees and all are idle
-		beeRemoved = false;
-		for (auto iter = mIdleBees.begin(); iter != mIdleBees.end(); ++iter)
-		{
-			if ((*iter)->GetState() != Bee::State::Idle)
-			{	// We know it isn't idle, so remove it
-				beeRemoved = true;
-				mIdleBees.erase(iter);
-				break;
-			}
-		}
-	}
+	auto beeManager = BeeManager::GetInstance();
+	mIdleBees.KeepIf([beeManager](const Handle<Bee>& handle)
+	{
+		auto bee = beeManager->FindBee(handle);
+		return bee != nullptr && bee->GetState() == Bee::State::Idle;
+	});
 }
 
-void Hive::UpdateKnownFoodSource(FoodSource* const foodSource, const std::pair<float, float>& foodSourceData)
+void Hive::AddThreat(const Handle<Wasp>& wasp)
 {
-	mFoodSourceData[foodSource] = foodSourceData;
+	mThreats.push_back(wasp);
 }
 
-void Hive::RemoveFoodSource(FoodSource* const foodSource)
+const vector<Handle<Wasp>>& Hive::Threats() const
 {
-	for (auto iter = mFoodSourceData.begin(); iter != mFoodSourceData.end(); ++iter)
-	{
-		if (iter->first == foodSource)
-		{
-			mFoodSourceData.erase(iter);
-			break;
-		}
-	}
+	return mThreats;
+}
+
+void Hive::UpdateKnownFoodSource(const Handle<FoodSource>& foodSource, const std::pair<float, float>& foodSourceData)
+{
+	mFoodSources.Update(foodSource, foodSourceData.first, foodSourceData.second);
+}
+
+void Hive::RemoveFoodSource(const Handle<FoodSource>& foodSource)
+{
+	mFoodSources.Remove(foodSource);
 }
 
 void Hive::TriggerWaggleDance()
 {
-	if (mFoodSourceData.size() > 8)
+	if (mFoodSources.Size() > 8)
 	{
-		mWaggleDanceClock.restart();
+		mWaggleDanceStartTime = World::GetInstance()->GetClock().GetElapsedTime();
 		mWaggleDanceInProgress = true;
 		CompleteWaggleDance();
-		mFoodSourceData.clear();
+		mFoodSources.Clear();
 	}
 }
 
 void Hive::CompleteWaggleDance()
 {
-	if (mFoodSourceData.size() == 0)
+	if (mFoodSources.Size() == 0)
 	{
 		return;
 	}
 
-	std::vector<std::pair<FoodSource*, float>> fitnessWeights;
-	float fitnessSum = 0.0f;
-
-	float minYield = mFoodSourceData.begin()->second.first;
-	float maxYield = mFoodSourceData.begin()->second.first;
-	float minDistance = mFoodSourceData.begin()->second.second;
-	float maxDistance = mFoodSourceData.begin()->second.second;
-	for (auto iter = mFoodSourceData.begin(); iter != mFoodSourceData.end(); ++iter)
-	{	// Determine the range of values to help determine fitness
-		auto pair = iter->second;
-		if (pair.first < minYield)
-		{
-			minYield = pair.first;
-		}
-		if (pair.first > maxYield)
-		{
-			maxYield = pair.first;
-		}
+	// The table keeps its ranges current as reports come in, so normalizing fitness needs no extra pass
+	const auto& yieldRange = mFoodSources.GetYieldRange();
+	const auto& distanceRange = mFoodSources.GetDistanceRange();
 
-		if (pair.second < minDistance)
-		{
-			minDistance = pair.second;
-		}
-		if (pair.second > maxDistance)
-		{
-			maxDistance = pair.second;
-		}
-	}
-
-	for (auto iter = mFoodSourceData.begin(); iter != mFoodSourceData.end(); ++iter)
+	// Resolve each food source once per dance rather than once per bee. Sources that no longer exist can't be chosen
+	auto foodSourceManager = FoodSourceManager::GetInstance();
+	mDanceWeights.clear();
+	mDanceTargets.clear();
+	for (uint32_t row = 0; row < mFoodSources.Size(); ++row)
 	{
-		float weight = ComputeFitness(iter->second, minYield, maxYield, minDistance, maxDistance);
-		std::pair<FoodSource* const, float> pair(iter->first, weight);
-		fitnessWeights.push_back(pair);
-		fitnessSum += weight;
+		auto foodSource = foodSourceManager->FindFoodSource(mFoodSources.GetFoodSource(row));
+		mDanceWeights.push_back(foodSource != nullptr ?
+			ComputeFitness(mFoodSources.GetYield(row), mFoodSources.GetDistance(row), yieldRange, distanceRange) : 0.0f);
+		mDanceTargets.push_back(foodSource);
 	}
-	
-	std::sort(fitnessWeights.begin(), fitnessWeights.end(), 
-		[](const std::pair<FoodSource* const, float>& lhs, const std::pair<FoodSource* const, float>& rhs)
-	{
-		return lhs.second > rhs.second;
-	});
+	mDanceTable.Build(mDanceWeights);
 
-	for (auto iter = IdleBeesBegin(); iter != IdleBeesEnd(); ++iter)
+	// Assign every idle bee in one pass. Bees that are sent out leave the idle set, along with any that have died
+	// or stopped idling since they were added, so no separate validation pass is needed
+	auto beeManager = BeeManager::GetInstance();
+	mIdleBees.KeepIf([this, beeManager](const Handle<Bee>& handle)
 	{
-		assert(*iter != nullptr);
-
-		std::uniform_real_distribution<float> distribution(0, fitnessSum);
-		float roll = distribution(mGenerator);
-		for (auto fitnessIter = fitnessWeights.begin(); fitnessIter != fitnessWeights.end(); ++fitnessIter)
+		auto bee = beeManager->FindBee(handle);
+		if (bee == nullptr || bee->GetState() != Bee::State::Idle)
 		{
-			roll -= fitnessIter->second;
-			if (roll < fitnessIter->second)
-			{
-				if (*iter != nullptr && fitnessIter->first != nullptr)
-				{
-					(*iter)->SetTarget(fitnessIter->first);
-					(*iter)->SetState(Bee::State::SeekingTarget);
-				}
-				break;
-			}
+			return false;
 		}
-	}
 
-	ValidateIdleBees();
+		auto foodSource = mDanceTable.IsEmpty() ? nullptr : mDanceTargets[mDanceTable.Sample(mGenerator)];
+		if (foodSource == nullptr)
+		{	// Nothing worth visiting was danced, so the bee keeps waiting
+			return true;
+		}
+
+		bee->SetTarget(foodSource);
+		bee->SetState(Bee::State::SeekingTarget);
+		return false;
+	});
+
 	mWaggleDanceInProgress = false;
 }
 
@@ -293,15 +253,14 @@ void Hive::ConvertToBroodComb(float combAmount)
 	mBroodComb += combAmount;
 }
 
-float Hive::ComputeFitness(const std::pair<float, float>& foodData,
-	const float& minYield, const float& maxYield,
-	const float& minDistance, const float& maxDistance)
+float Hive::ComputeFitness(const float& yield, const float& distance,
+	const FoodSourceKnowledge::Range& yields, const FoodSourceKnowledge::Range& distances)
 {
-	float offsetFromMinYield = foodData.first - minYield;
-	float yieldRange = maxYield - minYield;
+	float offsetFromMinYield = yield - yields.mMinimum;
+	float yieldRange = yields.mMaximum - yields.mMinimum;
 
-	float offsetFromMaxDistance = maxDistance - foodData.second;
-	float distanceRange = maxDistance - minDistance;
+	float offsetFromMaxDistance = distances.mMaximum - distance;
+	float distanceRange = distances.mMaximum - distances.mMinimum;
 
 	float result;
 	if (yieldRange == 0.0f && distanceRange == 0.0f)
@@ -361,24 +320,24 @@ void Hive::IncrementBeeCount(const BeeType& type)
 	}
 }
 
-void Hive::DecrementBeeCount(const BeeType& type)
+void Hive::DecrementBeeCount(const BeeType& type, const int& count)
 {
 	switch (type)
 	{
 	case Drone:
-		mDroneCount--;
+		mDroneCount -= count;
 		break;
 	case Employee:
-		mEmployeeCount--;
+		mEmployeeCount -= count;
 		break;
 	case Onlooker:
-		mOnlookerCount--;
+		mOnlookerCount -= count;
 		break;
 	case Queen:
-		mQueenCount--;
+		mQueenCount -= count;
 		break;
 	case Guard:
-		mGuardCount--;
+		mGuardCount -= count;
 		break;
 	}
 }
@@ -409,16 +368,22 @@ int Hive::GetBeeCount(const Bee::Type& type) const
 	return result;
 }
 
-bool Hive::FoodSourceIsKnown(FoodSource* const foodSource) const
+RandomStream Hive::CreateBeeStream()
 {
-	bool result = false;
-	for (auto iter = mFoodSourceData.begin(); iter != mFoodSourceData.end(); ++iter)
-	{
-		if ((*iter).first == foodSource)
-		{
-			result = true;
-			break;
-		}
-	}
-	return result;
+	return mBeeStream.Fork(mBirthCount++);
+}
+
+uint32_t Hive::GetId() const
+{
+	return mId;
+}
+
+const Handle<Hive>& Hive::GetHandle() const
+{
+	return mHandle;
+}
+
+bool Hive::FoodSourceIsKnown(const Handle<FoodSource>& foodSource) const
+{
+	return mFoodSources.Contains(foodSource);
 }
@@ -1,13 +1,22 @@
 #pragma once
 #include "Entity.h"
 #include "OnlookerBee.h"
-#include "HiveHUD.h"
+#include "RandomStream.h"
+#include "Handle.h"
+#include "AliasTable.h"
+#include "FoodSourceKnowledge.h"
 
 
+class Wasp;
+class WorldSnapshot;
+
 class Hive : public Entity
 {
 public:
 
+	static const float STANDARD_WIDTH;
+	static const float STANDARD_HEIGHT;
+
 	enum BeeType
 	{
 		Drone,
@@ -20,8 +29,9 @@ public:
 	/**
 	 * Constructor
 	 * @Param position: The starting position of the food source
+	 * @Param id: Identity of the hive, used to derive its random streams from the world seed
 	 */
-	explicit Hive(const sf::Vector2f& position);
+	explicit Hive(const sf::Vector2f& position, const std::uint32_t& id = 0);
 
 	/**
 	 *  Destructor
@@ -30,16 +40,15 @@ public:
 
 	/**
 	 * Updates the current game state of the hive
-	 * @Param window: The screen that the game is being rendered to
 	 * @Param deltaTime: The time elapsed since last Update
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
-	 * Renders the hive to the screen
-	 * @Param window: The screen which the hive is being rendered to
+	 * Copies the hive's position and the values its HUD shows into a snapshot of the world
+	 * @Param snapshot: The snapshot being captured, whose current cell is the one the hive is registered in
 	 */
-	void Render(sf::RenderWindow& window) const override;
+	void AddToSnapshot(WorldSnapshot& snapshot) const;
 
 	/**
 	 * Accessor method for the center point of the food source
@@ -86,30 +95,43 @@ public:
 
 	/**
 	 * Accessor for the Begin iterator of the idle bees
-	 * @Return: An iterator pointing to the beginning of the idle bees vector
+	 * @Return: An iterator pointing to the beginning of the idle bees' handles
 	 */
-	std::vector<OnlookerBee*>::iterator IdleBeesBegin();
+	HandleSet<Bee>::ConstIterator IdleBeesBegin() const;
 
 	/**
 	 * Accessor for the End iterator of the idle bees
-	 * @Return: An iterator pointing to the End of the idle bees vector
+	 * @Return: An iterator pointing to the End of the idle bees' handles
 	 */
-	std::vector<OnlookerBee*>::iterator IdleBeesEnd();
+	HandleSet<Bee>::ConstIterator IdleBeesEnd() const;
 
 	/**
-	 *  Iterates over the idle bees vector and removes all bees which are no longer idle
+	 *  Iterates over the idle bees once and removes all bees which are no longer idle or no longer exist
 	 */
 	void ValidateIdleBees();
 
+	/**
+	 * Adds a wasp to the hive's threats. Called by the wasp when it begins attacking this hive
+	 * @Param wasp: The handle of the wasp attacking the hive
+	 */
+	void AddThreat(const Handle<Wasp>& wasp);
+
+	/**
+	 * Accessor method for the wasps attacking the hive, so guards only consider their own hive's attackers.
+	 * Handles of wasps destroyed since the hive's last update are still listed and resolve to nullptr
+	 * @Return: The attacking wasps' handles, in the order they began their attack
+	 */
+	const std::vector<Handle<Wasp>>& Threats() const;
+
 	/**
 	 *  Deposits food source information into the hive
 	 */
-	void UpdateKnownFoodSource(class FoodSource* const foodSource, const std::pair<float, float>& foodSourceData);
+	void UpdateKnownFoodSource(const Handle<FoodSource>& foodSource, const std::pair<float, float>& foodSourceData);
 
 	/**
 	 *  Removes the food source from the list of known food sources, if it exists
 	 */
-	void RemoveFoodSource(class FoodSource* const foodSource);
+	void RemoveFoodSource(const Handle<FoodSource>& foodSource);
 
 	/**
 	 *  Causes all bees within the hive to watch the waggle dance and decide on updated food source data
@@ -117,7 +139,9 @@ public:
 	void TriggerWaggleDance();
 
 	/**
-	 *  After wait period has ended and no new scouts have delivered food, allow bees to choose their food source
+	 *  After wait period has ended and no new scouts have delivered food, allow bees to choose their food source.
+	 *  The fitness of every known food source is compiled into an alias table once per dance, then each idle bee
+	 *  draws its food source from the table in constant time
 	 */
 	void CompleteWaggleDance();
 
@@ -172,8 +196,9 @@ public:
 	/**
 	 * Decreases the count of bees of a certain type
 	 * @Param type: The type of bee being decremented
+	 * @Param count: The number of bees of that type being removed at once
 	 */
-	void DecrementBeeCount(const BeeType& type);
+	void DecrementBeeCount(const BeeType& type, const int& count = 1);
 
 	/**
 	 * Accessor for different bee types in the hive
@@ -187,40 +212,68 @@ public:
 	 * @Param foodSource: The food source under consideration
 	 * @Return: True if the food source is currently known by the hive
 	 */
-	bool FoodSourceIsKnown(FoodSource* const foodSource) const;
+	bool FoodSourceIsKnown(const Handle<FoodSource>& foodSource) const;
+
+	/**
+	 * Derives the random stream for the next bee born into this hive. Bees are numbered by birth within their
+	 * own hive, so a bee's stream does not depend on what any other hive has spawned
+	 * @Return: A random stream unique to the new bee
+	 */
+	RandomStream CreateBeeStream();
+
+	/**
+	 * Accessor method for the hive's identity
+	 * @Return: The index the hive was spawned with
+	 */
+	std::uint32_t GetId() const;
+
+	/**
+	 * Accessor method for the handle the HiveManager issued for this hive
+	 * @Return: The hive's handle. Null if the hive was not spawned by the manager
+	 */
+	const Handle<Hive>& GetHandle() const;
 
 private:
 
-	const float STANDARD_WIDTH = 200.0f;
-	const float STANDARD_HEIGHT = 200.0f;
+	friend class HiveManager;
+
+	/**
+	 * Registers the hive with the collision node under its position, moving it if it has left its old node
+	 */
+	void RefreshCollisionNode();
 
 	/**
-	 * Determines the fitness of the food source based on the minimum and maximum parameters and its relation to them
-	 * @Param fooddata: A pair of two floats containing the yield and distance of an individual food source
-	 * @Param minYield: The minimum yield of all known food sources
-	 * @Param maxYield: The maximum yield of all known food sources
-	 * @Param minDistance: The closest distance of all known food sources
-	 * @Param maxDistance: The farthest distance of all known food sources
+	 * Determines the fitness of the food source based on the range of known food sources and its relation to it
+	 * @Param yield: The yield of an individual food source
+	 * @Param distance: The distance of an individual food source
+	 * @Param yields: The range of yields of all known food sources
+	 * @Param distances: The range of distances of all known food sources
 	 * @Return: A float value between 0-1, where 0 is the worst possible fitness and 1 is best possible fitness
 	 */
-	static float ComputeFitness(const std::pair<float, float>& foodData, const float& minYield, const float& maxYield, const float& minDistance, const float& maxDistance);
+	static float ComputeFitness(const float& yield, const float& distance, const FoodSourceKnowledge::Range& yields,
+		const FoodSourceKnowledge::Range& distances);
 
 	// Fields
 	sf::Vector2f mDimensions;
-	sf::RectangleShape mBody;
 	float mFoodAmount;
-	sf::Text mText;
-	std::vector<OnlookerBee*> mIdleBees;
-	std::map<class FoodSource* const, std::pair<float, float>> mFoodSourceData;
-	std::default_random_engine mGenerator;
-	sf::Clock mWaggleDanceClock;
+	HandleSet<Bee> mIdleBees;
+	std::vector<Handle<Wasp>> mThreats;
+	FoodSourceKnowledge mFoodSources;
+	AliasTable mDanceTable;
+	std::vector<float> mDanceWeights;
+	std::vector<FoodSource*> mDanceTargets;
+	std::uint32_t mId;
+	Handle<Hive> mHandle;
+	RandomStream mGenerator;
+	RandomStream mBeeStream;
+	std::uint64_t mBirthCount;
+	double mWaggleDanceStartTime;
 	float mWaggleDanceWaitPeriod;
 	float mStructuralComb;
 	float mHoneyComb;
 	float mBroodComb;
 	bool mWaggleDanceInProgress;
 	int mOnlookerCount, mEmployeeCount, mDroneCount, mGuardCount, mQueenCount;
-	HiveHUD mHUD;
 
 };
 
@@ -4,112 +4,150 @@
 
 using namespace std;
 
+const float HiveHUD::DISPLAY_THRESHOLD = 0.005f;
+const uint32_t HiveHUD::VERTEX_COUNT = (HiveHUD::Bar::BarCount + 3 * 4) * 6;
+
 HiveHUD::HiveHUD(const sf::Vector2f& rootPosition, const sf::Vector2f& dimensions,
 	const int& onlookerCount, const int& employeeCount, int& droneCount, const int& guardCount, const int& queenCount,
 	const float& structuralComb, const float& honeyComb, const float& broodComb, const float& foodAmount):
 	mOnlookerCount(onlookerCount), mEmployeeCount(employeeCount), mDroneCount(droneCount), mQueenCount(queenCount), mGuardCount(guardCount),
 	mStructuralComb(structuralComb), mHoneyComb(honeyComb), mBroodComb(broodComb),
 	mRootPosition(rootPosition), mDimensions(dimensions), mFoodAmount(foodAmount),
-	mOutlineThickness(4)
+	mVertices(), mShownFractions(), mBuilt(false), mOutlineThickness(4)
 {
-	mBeeContainer.setFillColor(sf::Color::Transparent);
-	mBeeContainer.setOutlineColor(sf::Color(196, 196, 196));
-	mBeeContainer.setOutlineThickness(mOutlineThickness);
-
-	mCombContainer.setFillColor(sf::Color::Transparent);
-	mCombContainer.setOutlineColor(sf::Color(196, 196, 196));
-	mCombContainer.setOutlineThickness(mOutlineThickness);
-
-	mFoodContainer.setFillColor(sf::Color::Transparent);
-	mFoodContainer.setOutlineColor(sf::Color(196, 196, 196));
-	mFoodContainer.setOutlineThickness(mOutlineThickness);
-
-	mBarOnlookers.setFillColor(sf::Color(255, 204, 0));
-	mBarEmployees.setFillColor(sf::Color::Cyan);
-	mBarDrones.setFillColor(sf::Color(128, 128, 128));
-	mBarGuards.setFillColor(sf::Color(128, 0, 0));
-	mBarQueens.setFillColor(sf::Color::Magenta);
-
-	mBarStructuralComb.setFillColor(sf::Color(225, 225, 225));
-	mBarHoneyComb.setFillColor(sf::Color::Green);
-	mBarBroodComb.setFillColor(sf::Color(255, 164, 0));
-	mBarFoodAmount.setFillColor(sf::Color::Green);
-
-	mBarOnlookers.setOutlineColor(sf::Color::Transparent);
-	mBarEmployees.setOutlineColor(sf::Color::Transparent);
-	mBarGuards.setOutlineColor(sf::Color::Transparent);
-	mBarDrones.setOutlineColor(sf::Color::Transparent);
-	mBarQueens.setOutlineColor(sf::Color::Transparent);
-	mBarStructuralComb.setOutlineColor(sf::Color::Transparent);
-	mBarHoneyComb.setOutlineColor(sf::Color::Transparent);
-	mBarBroodComb.setOutlineColor(sf::Color::Transparent);
-	mBarFoodAmount.setOutlineColor(sf::Color::Transparent);
+	mVertices.reserve(VERTEX_COUNT);
 	UpdateHUDValues();
 }
 
-void HiveHUD::Render(sf::RenderWindow& window) const
+void HiveHUD::Render(sf::RenderTarget& window) const
 {
-	window.draw(mBarOnlookers);
-	window.draw(mBarEmployees);
-	window.draw(mBarDrones);
-	window.draw(mBarGuards);
-	window.draw(mBarQueens);
-
-	window.draw(mBarStructuralComb);
-	window.draw(mBarHoneyComb);
-	window.draw(mBarBroodComb);
-
-	window.draw(mBarFoodAmount);
-
-	window.draw(mBeeContainer);
-	window.draw(mCombContainer);
-	window.draw(mFoodContainer);
+	window.draw(mVertices.data(), mVertices.size(), sf::Triangles);
 }
 
-void HiveHUD::UpdateHUDValues()
+bool HiveHUD::UpdateHUDValues()
 {
-	float beeSum = mOnlookerCount + mEmployeeCount + mDroneCount + mGuardCount + mQueenCount;
-
-	mBeeContainer.setPosition(mRootPosition);
-	mBeeContainer.setSize(mDimensions);
-
-	mBarOnlookers.setPosition(mRootPosition);
-	mBarOnlookers.setSize(sf::Vector2f(mDimensions.x * (mOnlookerCount / beeSum), mDimensions.y));
+	auto fractions = BarFractions();
+	if (mBuilt)
+	{
+		bool moved = false;
+		for (uint32_t i = 0; i < Bar::BarCount; ++i)
+		{
+			if (abs(fractions[i] - mShownFractions[i]) > DISPLAY_THRESHOLD)
+			{
+				moved = true;
+				break;
+			}
+		}
+
+		if (!moved)
+		{	// Nothing has changed by enough to be seen, so the old geometry still stands
+			return false;
+		}
+	}
 
-	mBarEmployees.setPosition(sf::Vector2f(mBarOnlookers.getPosition().x + mBarOnlookers.getSize().x, mRootPosition.y));
-	mBarEmployees.setSize(sf::Vector2f(mDimensions.x * (mEmployeeCount / beeSum), mDimensions.y));
+	BuildGeometry(fractions);
+	return true;
+}
 
-	mBarDrones.setPosition(sf::Vector2f(mBarEmployees.getPosition().x + mBarEmployees.getSize().x, mRootPosition.y));
-	mBarDrones.setSize(sf::Vector2f(mDimensions.x * (mDroneCount / beeSum), mDimensions.y));
+void HiveHUD::AppendVertices(vector<sf::Vertex>& vertices) const
+{
+	vertices.insert(vertices.end(), mVertices.begin(), mVertices.end());
+}
 
-	mBarGuards.setPosition(sf::Vector2f(mBarDrones.getPosition().x + mBarDrones.getSize().x, mRootPosition.y));
-	mBarGuards.setSize(sf::Vector2f(mDimensions.x * (mGuardCount / beeSum), mDimensions.y));
+const vector<sf::Vertex>& HiveHUD::GetVertices() const
+{
+	return mVertices;
+}
 
-	mBarQueens.setPosition(sf::Vector2f(mBarGuards.getPosition().x + mBarGuards.getSize().x, mRootPosition.y));
-	mBarQueens.setSize(sf::Vector2f(mDimensions.x * (mQueenCount / beeSum), mDimensions.y));
+HiveHUD::Fractions HiveHUD::BarFractions() const
+{
+	Fractions fractions;
+	fractions.fill(0.0f);
+
+	float beeSum = static_cast<float>(mOnlookerCount + mEmployeeCount + mDroneCount + mGuardCount + mQueenCount);
+	if (beeSum > 0.0f)
+	{
+		fractions[Bar::Onlookers] = mOnlookerCount / beeSum;
+		fractions[Bar::Employees] = mEmployeeCount / beeSum;
+		fractions[Bar::Drones] = mDroneCount / beeSum;
+		fractions[Bar::Guards] = mGuardCount / beeSum;
+		fractions[Bar::Queens] = mQueenCount / beeSum;
+	}
 
 	float combSum = mStructuralComb + mHoneyComb + mBroodComb;
+	if (combSum > 0.0f)
+	{
+		fractions[Bar::HoneyComb] = mHoneyComb / combSum;
+		fractions[Bar::BroodComb] = mBroodComb / combSum;
+		fractions[Bar::StructuralComb] = mStructuralComb / combSum;
+	}
+
+	if (mHoneyComb > 0.0f)
+	{	// Food fills the honey comb, so its bar is as wide as the honey comb's at most
+		fractions[Bar::FoodAmount] = fractions[Bar::HoneyComb] * min(mFoodAmount / mHoneyComb, 1.0f);
+	}
 
-	mCombContainer.setPosition(mRootPosition + sf::Vector2f(0, mDimensions.y + mOutlineThickness));
-	mCombContainer.setSize(mDimensions);
+	return fractions;
+}
 
-	mBarHoneyComb.setPosition(mCombContainer.getPosition());
-	mBarHoneyComb.setSize(sf::Vector2f(mDimensions.x * (mHoneyComb / combSum), mDimensions.y));
+void HiveHUD::BuildGeometry(const Fractions& fractions)
+{
+	mVertices.clear();
+
+	const sf::Color barColors[] = { sf::Color(255, 204, 0), sf::Color::Cyan, sf::Color(128, 128, 128),
+		sf::Color(128, 0, 0), sf::Color::Magenta, sf::Color::Green, sf::Color(255, 164, 0), sf::Color(225, 225, 225),
+		sf::Color::Green };
+
+	// Bees, then comb, then food, one row each with each row's bars laid end to end
+	sf::Vector2f rowStep(0, mDimensions.y + mOutlineThickness);
+	sf::Vector2f beeRow = mRootPosition;
+	sf::Vector2f combRow = beeRow + rowStep;
+	sf::Vector2f foodRow = combRow + rowStep;
+
+	auto position = beeRow;
+	for (uint32_t i = Bar::Onlookers; i <= Bar::StructuralComb; ++i)
+	{
+		if (i == Bar::HoneyComb)
+		{
+			position = combRow;
+		}
+
+		sf::Vector2f size(mDimensions.x * fractions[i], mDimensions.y);
+		AddRectangle(position, size, barColors[i]);
+		position.x += size.x;
+	}
+	AddRectangle(foodRow, sf::Vector2f(mDimensions.x * fractions[Bar::FoodAmount], mDimensions.y),
+		barColors[Bar::FoodAmount]);
 
-	mBarBroodComb.setPosition(mBarHoneyComb.getPosition() + sf::Vector2f(mBarHoneyComb.getSize().x, 0));
-	mBarBroodComb.setSize(sf::Vector2f(mDimensions.x * (mBroodComb / combSum), mDimensions.y));
+	AddOutline(beeRow, mDimensions);
+	AddOutline(combRow, mDimensions);
+	AddOutline(foodRow, mDimensions);
 
-	mBarStructuralComb.setPosition(mBarBroodComb.getPosition() + sf::Vector2f(mBarBroodComb.getSize().x, 0));
-	mBarStructuralComb.setSize(sf::Vector2f(mDimensions.x * (mStructuralComb / combSum), mDimensions.y));
+	mShownFractions = fractions;
+	mBuilt = true;
+}
 
-	mFoodContainer.setPosition(mCombContainer.getPosition() + sf::Vector2f(0, mDimensions.y + mOutlineThickness));
-	mFoodContainer.setSize(mDimensions);
+void HiveHUD::AddRectangle(const sf::Vector2f& position, const sf::Vector2f& size, const sf::Color& color)
+{
+	sf::Vector2f topRight(position.x + size.x, position.y);
+	sf::Vector2f bottomRight = position + size;
+	sf::Vector2f bottomLeft(position.x, position.y + size.y);
+
+	mVertices.emplace_back(position, color);
+	mVertices.emplace_back(topRight, color);
+	mVertices.emplace_back(bottomRight, color);
+	mVertices.emplace_back(position, color);
+	mVertices.emplace_back(bottomRight, color);
+	mVertices.emplace_back(bottomLeft, color);
+}
 
-	mBarFoodAmount.setPosition(mFoodContainer.getPosition());
-	float barPercentage = mFoodAmount / mHoneyComb;
-	if (barPercentage > 1.0f)
-	{	// Clamp food amount
-		barPercentage = 1.0f;
-	}
-	mBarFoodAmount.setSize(sf::Vector2f(mBarHoneyComb.getSize().x * barPercentage, mDimensions.y));
+void HiveHUD::AddOutline(const sf::Vector2f& position, const sf::Vector2f& size)
+{
+	// Like a shape's outline, the frame grows outward from the rectangle it surrounds
+	const sf::Color color(196, 196, 196);
+	auto thickness = mOutlineThickness;
+	AddRectangle(position - sf::Vector2f(thickness, thickness), sf::Vector2f(size.x + 2 * thickness, thickness), color);
+	AddRectangle(position + sf::Vector2f(-thickness, size.y), sf::Vector2f(size.x + 2 * thickness, thickness), color);
+	AddRectangle(position - sf::Vector2f(thickness, 0), sf::Vector2f(thickness, size.y), color);
+	AddRectangle(position + sf::Vector2f(size.x, 0), sf::Vector2f(thickness, size.y), color);
 }
@@ -1,10 +1,29 @@
 #pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics.hpp>
 
 
+/**
+ * Bars showing the make up of a hive's bees, comb and food. The bars are kept as one triangle list, which is only
+ * rebuilt when a bound value has moved a bar by more than DISPLAY_THRESHOLD, and which can be appended to a batch so
+ * the HUDs of many hives are drawn together
+ */
 class HiveHUD
 {
 public:
 
+	/**
+	 * How far, as a fraction of the HUD's width, a bar has to move before the geometry is rebuilt
+	 */
+	const static float DISPLAY_THRESHOLD;
+
+	/**
+	 * The number of vertices in every HUD's triangle list
+	 */
+	const static std::uint32_t VERTEX_COUNT;
+
 #pragma region Construction/Copy/Assignment
 
 	HiveHUD(
@@ -25,18 +44,78 @@ public:
 #pragma endregion
 
 	/**
-	 * Renders the HUD to the screen
+	 * Renders the HUD to the screen with one draw call
 	 * @Param window: The window that the HUD is being rendered to
 	 */
-	void Render(sf::RenderWindow& window) const;
+	void Render(sf::RenderTarget& window) const;
 
 	/**
-	 *  Updates the relative size representations of the contents of the hive
+	 * Updates the relative size representations of the contents of the hive, rebuilding the geometry if any bar has
+	 * moved by more than DISPLAY_THRESHOLD since it was last built
+	 * @Return: True if the geometry was rebuilt
 	 */
-	void UpdateHUDValues();
+	bool UpdateHUDValues();
+
+	/**
+	 * Adds the HUD's triangles to the end of a batch
+	 * @Param vertices: The batch being built
+	 */
+	void AppendVertices(std::vector<sf::Vertex>& vertices) const;
+
+	/**
+	 * Accessor method for the HUD's triangle list
+	 * @Return: VERTEX_COUNT vertices, the bars first and the outlines of their containers over them
+	 */
+	const std::vector<sf::Vertex>& GetVertices() const;
 
 private:
 
+	/**
+	 * The width of each bar, as a fraction of the HUD's width
+	 */
+	enum Bar
+	{
+		Onlookers,
+		Employees,
+		Drones,
+		Guards,
+		Queens,
+		HoneyComb,
+		BroodComb,
+		StructuralComb,
+		FoodAmount,
+		BarCount
+	};
+
+	typedef std::array<float, Bar::BarCount> Fractions;
+
+	/**
+	 * Works out how much of the HUD's width each bar covers with the current values
+	 * @Return: The width of every bar, as a fraction of the HUD's width
+	 */
+	Fractions BarFractions() const;
+
+	/**
+	 * Replaces the triangle list with one built from a set of bar widths
+	 * @Param fractions: The width of every bar, as a fraction of the HUD's width
+	 */
+	void BuildGeometry(const Fractions& fractions);
+
+	/**
+	 * Adds a filled rectangle as two triangles
+	 * @Param position: The top left corner of the rectangle
+	 * @Param size: The size of the rectangle
+	 * @Param color: The color of the rectangle
+	 */
+	void AddRectangle(const sf::Vector2f& position, const sf::Vector2f& size, const sf::Color& color);
+
+	/**
+	 * Adds a frame drawn just outside a rectangle
+	 * @Param position: The top left corner of the rectangle being framed
+	 * @Param size: The size of the rectangle being framed
+	 */
+	void AddOutline(const sf::Vector2f& position, const sf::Vector2f& size);
+
 	// Data references
 	const int& mOnlookerCount;
 	const int& mEmployeeCount;
@@ -51,19 +130,9 @@ private:
 	// Rendering components
 	sf::Vector2f mRootPosition;
 	sf::Vector2f mDimensions;
-	sf::RectangleShape mBeeContainer;
-	sf::RectangleShape mCombContainer;
-	sf::RectangleShape mFoodContainer;
-	sf::RectangleShape mBarOnlookers;
-	sf::RectangleShape mBarEmployees;
-	sf::RectangleShape mBarDrones;
-	sf::RectangleShape mBarGuards;
-	sf::RectangleShape mBarQueens;
-	sf::RectangleShape mBarStructuralComb;
-	sf::RectangleShape mBarHoneyComb;
-	sf::RectangleShape mBarBroodComb;
-	sf::RectangleShape mBarFoodAmount;
-	
+	std::vector<sf::Vertex> mVertices;
+	Fractions mShownFractions;
+	bool mBuilt;
 	float mOutlineThickness;
 };
 
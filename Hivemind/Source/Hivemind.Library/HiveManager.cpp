@@ -6,7 +6,8 @@ using namespace std;
 
 HiveManager* HiveManager::sInstance = nullptr;
 
-HiveManager::HiveManager()
+HiveManager::HiveManager() :
+	mHives(), mHandles()
 {}
 
 HiveManager* HiveManager::GetInstance()
@@ -23,6 +24,7 @@ HiveManager::~HiveManager()
 {
 	for (auto iter = mHives.begin(); iter != mHives.end(); ++iter)
 	{
+		mHandles.Release((*iter)->mHandle);
 		delete (*iter);
 	}
 	mHives.clear();
@@ -30,23 +32,19 @@ HiveManager::~HiveManager()
 
 Hive& HiveManager::SpawnHive(const sf::Vector2f& position)
 {
-	mHives.push_back(new Hive(position));
+	auto hive = new Hive(position, static_cast<uint32_t>(mHives.size()));
+	hive->mHandle = mHandles.Issue(hive);
+	// Snapshots are captured through the collision grid, so hives must be registered before their first update
+	hive->RefreshCollisionNode();
+	mHives.push_back(hive);
 	return (*mHives.back());
 }
 
-void HiveManager::Update(sf::RenderWindow& window, const float& deltaTime)
+void HiveManager::Update(const float& deltaTime)
 {
 	for (auto iter = mHives.begin(); iter != mHives.end(); ++iter)
 	{
-		(*iter)->Update(window, deltaTime);
-	}
-}
-
-void HiveManager::Render(sf::RenderWindow& window)
-{
-	for (auto iter = mHives.begin(); iter != mHives.end(); ++iter)
-	{
-		(*iter)->Render(window);
+		(*iter)->Update(deltaTime);
 	}
 }
 
@@ -60,12 +58,22 @@ std::vector<Hive*>::iterator HiveManager::End()
 	return mHives.end();
 }
 
+std::uint32_t HiveManager::GetHiveCount() const
+{
+	return static_cast<std::uint32_t>(mHives.size());
+}
+
 Hive* HiveManager::GetHive(std::uint32_t index)
 {
 	if (index >= mHives.size())
 	{
-		throw exception("Index out of bounds");
+		throw out_of_range("Index out of bounds");
 	}
 
 	return mHives[index];
 }
+
+Hive* HiveManager::FindHive(const Handle<Hive>& handle) const
+{
+	return mHandles.Find(handle);
+}
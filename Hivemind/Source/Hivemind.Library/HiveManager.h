@@ -1,5 +1,6 @@
 #pragma once
 #include <random>
+#include "Handle.h"
 
 
 class Hive;
@@ -43,16 +44,9 @@ public:
 
 	/**
 	 * Disseminates update calls to all existing hives
-	 * @Param window: The screen which all hives are rendered to
 	 * @Param deltaTime: The time since last update call
 	 */
-	void Update(sf::RenderWindow& window, const float& deltaTime);
-
-	/**
-	 * Disseminates render calls to all existing hives
-	 * @Param window: The screen which all hives are rendered to
-	 */
-	void Render(sf::RenderWindow& window);
+	void Update(const float& deltaTime);
 
 	/**
 	 * Accessor method for the beginning of the list of hives
@@ -73,11 +67,24 @@ public:
 	 */
 	Hive* GetHive(std::uint32_t index);
 
+	/**
+	 * Accessor method for the size of the hive list
+	 * @Return: The total number of hives in the simulation
+	 */
+	std::uint32_t GetHiveCount() const;
+
+	/**
+	 * Resolves a handle issued by this manager
+	 * @Param handle: The handle of the hive being looked up
+	 * @Return: A pointer to the hive, or nullptr if the handle is null or stale
+	 */
+	Hive* FindHive(const Handle<Hive>& handle) const;
+
 private:
 
 	static HiveManager* sInstance;
 	std::vector<Hive*> mHives;
-	std::default_random_engine generator;
+	HandleTable<Hive> mHandles;
 
 };
 
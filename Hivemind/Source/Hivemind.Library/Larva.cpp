@@ -7,18 +7,18 @@ Larva::Larva(const sf::Vector2f& position, Hive& hive, const LarvaType& larvaTyp
 	mTimeSinceBirth(0.0f), mLarvaDuration(3.0f), mLarvaType(larvaType)
 {
 	mFillColor = sf::Color::Blue;
-	mFace.setSize(sf::Vector2f(0, 0));
-	mBody.setRadius(BodyRadius / 3.0f);
+	mFaceLength = 0.0f;
+	mBodyRadius = BodyRadius / 3.0f;
 }
 
-void Larva::Update(sf::RenderWindow& window, const double& deltaTime)
+void Larva::Update(const double& deltaTime)
 {
-	Bee::Update(window, deltaTime);
+	Bee::Update(deltaTime);
 
 	mTimeSinceBirth += deltaTime;
 	if (mTimeSinceBirth >= mLarvaDuration)
 	{
-		Hatch();
+		Defer([this]() { Hatch(); });
 	}
 }
 
@@ -27,26 +27,30 @@ void Larva::Render(sf::RenderWindow& window) const
 	Bee::Render(window);
 }
 
+void Larva::UpdatePresentation()
+{
+}
+
 void Larva::Hatch()
 {
 	mMarkedForDelete = true;
-	auto beeManager = BeeManager::GetInstance();
+	auto& commands = BeeManager::GetInstance()->GetCommands();
 	switch (mLarvaType)
 	{
 	case Drone:
-		beeManager->SpawnDrone(mPosition, mParentHive);
+		commands.SpawnBee(Bee::Type::Drone, Position(), mParentHive);
 		break;
 	case Employee:
-		beeManager->SpawnEmployee(mPosition, mParentHive);
+		commands.SpawnBee(Bee::Type::Employee, Position(), mParentHive);
 		break;
 	case Onlooker:
-		beeManager->SpawnOnlooker(mPosition, mParentHive);
+		commands.SpawnBee(Bee::Type::Onlooker, Position(), mParentHive);
 		break;
 	case Queen:
-		beeManager->SpawnQueen(mPosition, mParentHive);
+		commands.SpawnBee(Bee::Type::Queen, Position(), mParentHive);
 		break;
 	case Guard:
-		beeManager->SpawnGuard(mPosition, mParentHive);
+		commands.SpawnBee(Bee::Type::Guard, Position(), mParentHive);
 		break;
 	default:
 		break;
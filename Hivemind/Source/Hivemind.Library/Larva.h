@@ -41,10 +41,9 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 * Render method called by the main game loop
@@ -52,10 +51,10 @@ public:
 	 */
 	void Render(sf::RenderWindow& window) const override;
 
-protected:
-
-	// Larva don't have states so we don't need to use the function map
-	void PopulateFunctionMaps() override {}
+	/**
+	 * Larva never move, so their shapes stay where the constructor placed them
+	 */
+	void UpdatePresentation() override;
 
 private:
 
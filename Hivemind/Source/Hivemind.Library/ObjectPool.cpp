@@ -0,0 +1,40 @@
+#include "pch.h"
+#include "ObjectPool.h"
+
+
+using namespace std;
+
+PoolStatistics::PoolStatistics() :
+	mCapacity(0), mLiveCount(0), mHighWaterMark(0), mCreateCount(0), mRecycleCount(0)
+{
+}
+
+uint32_t PoolStatistics::GetCapacity() const
+{
+	return mCapacity;
+}
+
+uint32_t PoolStatistics::GetLiveCount() const
+{
+	return mLiveCount;
+}
+
+uint32_t PoolStatistics::GetHighWaterMark() const
+{
+	return mHighWaterMark;
+}
+
+uint64_t PoolStatistics::GetCreateCount() const
+{
+	return mCreateCount;
+}
+
+uint64_t PoolStatistics::GetRecycleCount() const
+{
+	return mRecycleCount;
+}
+
+float PoolStatistics::GetRecycleRate() const
+{
+	return (mCreateCount > 0) ? static_cast<float>(mRecycleCount) / mCreateCount : 0.0f;
+}
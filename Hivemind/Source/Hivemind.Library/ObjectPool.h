@@ -0,0 +1,252 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/**
+ * Running counters for an object pool, shared by every pooled type so they can be reported side by side
+ */
+class PoolStatistics
+{
+
+public:
+
+	PoolStatistics();
+
+	/**
+	 * Accessor method for the number of slots carved from the heap so far
+	 * @Return: The total number of objects the pool can hold without growing
+	 */
+	std::uint32_t GetCapacity() const;
+
+	/**
+	 * Accessor method for the number of objects currently alive in the pool
+	 * @Return: The number of created objects that have not been destroyed
+	 */
+	std::uint32_t GetLiveCount() const;
+
+	/**
+	 * Accessor method for the largest number of objects that were ever alive at once
+	 * @Return: The peak live count
+	 */
+	std::uint32_t GetHighWaterMark() const;
+
+	/**
+	 * Accessor method for the number of objects ever created by the pool
+	 * @Return: The total number of creations
+	 */
+	std::uint64_t GetCreateCount() const;
+
+	/**
+	 * Accessor method for the number of creations that reused the storage of a destroyed object
+	 * @Return: The total number of recycled creations
+	 */
+	std::uint64_t GetRecycleCount() const;
+
+	/**
+	 * Determines how often the pool served a creation without carving new storage
+	 * @Return: A value from 0-1, the fraction of creations that recycled storage
+	 */
+	float GetRecycleRate() const;
+
+private:
+
+	template <typename T>
+	friend class ObjectPool;
+
+	std::uint32_t mCapacity;
+	std::uint32_t mLiveCount;
+	std::uint32_t mHighWaterMark;
+	std::uint64_t mCreateCount;
+	std::uint64_t mRecycleCount;
+
+};
+
+/**
+ * Recycles storage for objects of a single type. Storage is carved from fixed size slabs, and destroyed objects
+ * return their slot to a free list for the next creation. Slabs are only handed back to the heap when the pool is
+ * destroyed, so constant spawning and dying does not fragment the global heap
+ */
+template <typename T>
+class ObjectPool
+{
+
+public:
+
+	const static std::uint32_t DEFAULT_SLAB_SIZE = 256;
+
+#pragma region Construction/Copy/Assignment
+
+	/**
+	 * Constructor. No storage is carved until the first creation
+	 * @Param slabSize: The number of objects carved from the heap at once whenever the pool runs dry
+	 */
+	explicit ObjectPool(const std::uint32_t& slabSize = DEFAULT_SLAB_SIZE);
+
+	/**
+	 * Destructor. Every object created by the pool must already have been destroyed
+	 */
+	~ObjectPool();
+
+	ObjectPool(const ObjectPool& rhs) = delete;
+
+	ObjectPool& operator=(const ObjectPool& rhs) = delete;
+
+	ObjectPool(ObjectPool&& rhs) = delete;
+
+	ObjectPool& operator=(ObjectPool&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Constructs an object in pooled storage, reusing the slot of a destroyed object if one is free
+	 * @Param args: The arguments forwarded to the object's constructor
+	 * @Return: A pointer to the new object. Must be released through Destroy, never delete
+	 */
+	template <typename... Args>
+	T* Create(Args&&... args);
+
+	/**
+	 * Destructs an object and returns its slot to the pool
+	 * @Param object: An object previously returned by Create on this pool
+	 */
+	void Destroy(T* const object);
+
+	/**
+	 * Accessor method for the pool's counters
+	 * @Return: The capacity, live count, high-water mark and recycle counts of the pool
+	 */
+	const PoolStatistics& GetStatistics() const;
+
+private:
+
+	/**
+	 * Storage for one object. While the slot is free its memory holds the link to the next free slot
+	 */
+	union Slot
+	{
+		Slot* mNext;
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type mStorage;
+	};
+
+	/**
+	 * Takes a slot from the free list, or from the unused end of the newest slab, carving a new slab if both are empty
+	 * @Return: Uninitialized storage for one object
+	 */
+	Slot* AcquireSlot();
+
+	std::vector<Slot*> mSlabs;
+	Slot* mFreeList;
+	std::uint32_t mSlabSize;
+	std::uint32_t mSlabUsed;
+	PoolStatistics mStatistics;
+
+};
+
+template <typename T>
+const std::uint32_t ObjectPool<T>::DEFAULT_SLAB_SIZE;
+
+template <typename T>
+ObjectPool<T>::ObjectPool(const std::uint32_t& slabSize) :
+	mSlabs(), mFreeList(nullptr), mSlabSize(slabSize), mSlabUsed(slabSize), mStatistics()
+{
+	assert(slabSize > 0);
+}
+
+template <typename T>
+ObjectPool<T>::~ObjectPool()
+{
+	assert(mStatistics.mLiveCount == 0);
+	for (auto iter = mSlabs.begin(); iter != mSlabs.end(); ++iter)
+	{
+		delete[] (*iter);
+	}
+	mSlabs.clear();
+}
+
+template <typename T>
+template <typename... Args>
+T* ObjectPool<T>::Create(Args&&... args)
+{
+	bool recycled = (mFreeList != nullptr);
+	Slot* slot = AcquireSlot();
+
+	T* object = nullptr;
+	try
+	{
+		object = new (&slot->mStorage) T(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		if (recycled)
+		{	// The slot held a live object before, so it goes straight back on the free list
+			slot->mNext = mFreeList;
+			mFreeList = slot;
+		}
+		else
+		{	// The slot was freshly carved, so the carve is undone and the next creation is not counted as a recycle
+			mSlabUsed--;
+		}
+		throw;
+	}
+
+	mStatistics.mCreateCount++;
+	if (recycled)
+	{
+		mStatistics.mRecycleCount++;
+	}
+	mStatistics.mLiveCount++;
+	if (mStatistics.mLiveCount > mStatistics.mHighWaterMark)
+	{
+		mStatistics.mHighWaterMark = mStatistics.mLiveCount;
+	}
+
+	return object;
+}
+
+template <typename T>
+void ObjectPool<T>::Destroy(T* const object)
+{
+	if (object == nullptr)
+	{
+		return;
+	}
+
+	assert(mStatistics.mLiveCount > 0);
+	object->~T();
+
+	auto slot = reinterpret_cast<Slot*>(object);
+	slot->mNext = mFreeList;
+	mFreeList = slot;
+	mStatistics.mLiveCount--;
+}
+
+template <typename T>
+const PoolStatistics& ObjectPool<T>::GetStatistics() const
+{
+	return mStatistics;
+}
+
+template <typename T>
+typename ObjectPool<T>::Slot* ObjectPool<T>::AcquireSlot()
+{
+	if (mFreeList != nullptr)
+	{
+		Slot* slot = mFreeList;
+		mFreeList = slot->mNext;
+		return slot;
+	}
+
+	if (mSlabUsed == mSlabSize)
+	{	// Every slot ever carved is alive, so grow by another slab
+		mSlabs.push_back(new Slot[mSlabSize]);
+		mSlabUsed = 0;
+		mStatistics.mCapacity += mSlabSize;
+	}
+
+	return &mSlabs.back()[mSlabUsed++];
+}
@@ -7,50 +7,68 @@ using namespace std;
 OnlookerBee::OnlookerBee(const sf::Vector2f& position, Hive& hive) :
 	Bee(position, hive)
 {
-	mState = State::DeliveringFood;
-	OnlookerBee::PopulateFunctionMaps();
+	CurrentState() = State::DeliveringFood;
 }
 
-void OnlookerBee::Update(sf::RenderWindow& window, const double& deltaTime)
+void OnlookerBee::Update(const double& deltaTime)
 {
-	Bee::Update(window, deltaTime);
-
-	if (MarkedForDelete())
+	switch (CurrentState())
 	{
-		mParentHive.RemoveIdleBee(this);
+	case State::Idle:
+		StepIdle(deltaTime);
+		break;
+	case State::SeekingTarget:
+		StepSeekingTarget(deltaTime);
+		break;
+	case State::HarvestingFood:
+		StepHarvestingFood(deltaTime);
+		break;
+	case State::DeliveringFood:
+		StepDeliveringFood(deltaTime);
+		break;
+	case State::DepositingFood:
+		StepDepositingFood(deltaTime);
+		break;
+	default:
+		assert(false);
 	}
-
-	assert(mState != State::Scouting);
-	mUpdate[mState](window, deltaTime);
 }
 
-void OnlookerBee::PopulateFunctionMaps()
+void OnlookerBee::StepIdle(const double& deltaTime)
 {
-	mUpdate[State::Idle] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateIdle(window, deltaTime); };
-
-	mUpdate[State::SeekingTarget] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateSeekingTarget(window, deltaTime); };
+	Bee::Update(deltaTime);
+	UpdateIdle(deltaTime);
+}
 
-	mUpdate[State::HarvestingFood] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateHarvestingFood(window, deltaTime); };
+void OnlookerBee::StepSeekingTarget(const double& deltaTime)
+{
+	Bee::Update(deltaTime);
+	UpdateSeekingTarget(deltaTime);
+}
 
-	mUpdate[State::DeliveringFood] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateDeliveringFood(window, deltaTime); };
+void OnlookerBee::StepHarvestingFood(const double& deltaTime)
+{
+	Bee::Update(deltaTime);
+	UpdateHarvestingFood(deltaTime);
+}
 
-	mUpdate[State::DepositingFood] = [&](sf::RenderWindow& window, const double& deltaTime)
-	{ this->UpdateDepositingFood(window, deltaTime); };
+void OnlookerBee::StepDeliveringFood(const double& deltaTime)
+{
+	Bee::Update(deltaTime);
+	UpdateDeliveringFood(deltaTime);
 }
 
-void OnlookerBee::UpdateIdle(sf::RenderWindow& window, const double& deltaTime)
+void OnlookerBee::StepDepositingFood(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
+	Bee::Update(deltaTime);
+	UpdateDepositingFood(deltaTime);
+}
 
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	float rotationAngle = rotationRadians * (180 / PI);
+void OnlookerBee::UpdateIdle(const double& deltaTime)
+{
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
 
-	if (DistanceBetween(mTarget, mPosition) <= TARGET_RADIUS)
+	if (DistanceBetween(Target(), Position()) <= TARGET_RADIUS)
 	{
 		auto dimensions = mParentHive.GetDimensions();
 		uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x / 2), static_cast<int>(dimensions.x / 2));
@@ -60,109 +78,83 @@ void OnlookerBee::UpdateIdle(sf::RenderWindow& window, const double& deltaTime)
 	}
 
 	sf::Vector2f newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
-
-	mPosition = newPosition;
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 
-	PostUpdate(newPosition, rotationAngle);
+	Position() = newPosition;
 }
 
-void OnlookerBee::UpdateSeekingTarget(sf::RenderWindow& window, const double& deltaTime)
+void OnlookerBee::UpdateSeekingTarget(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	float rotationAngle = rotationRadians * (180 / PI);
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
 
 	sf::Vector2f newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 	HandleFoodSourceCollisions();
 
-	PostUpdate(newPosition, rotationAngle);
+	Position() = newPosition;
 }
 
-void OnlookerBee::UpdateHarvestingFood(sf::RenderWindow& window, const double& deltaTime)
+void OnlookerBee::UpdateHarvestingFood(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	float rotationAngle = rotationRadians * (180 / PI);
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
 
-	sf::Vector2f newPosition = mPosition;
+	sf::Vector2f newPosition = Position();
+	auto foodSource = TargetFoodSource();
 
-	if (mTargetFoodSource != nullptr)
+	if (foodSource != nullptr)
 	{
-		if (DistanceBetween(mTarget, mPosition) <= TARGET_RADIUS)
+		if (DistanceBetween(Target(), Position()) <= TARGET_RADIUS)
 		{
-			auto dimensions = mTargetFoodSource->GetDimensions();
+			auto dimensions = foodSource->GetDimensions();
 			uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x / 2), static_cast<int>(dimensions.x / 2));
 			uniform_int_distribution<int> distributionY(static_cast<int>(-dimensions.y / 2), static_cast<int>(dimensions.y / 2));
 			sf::Vector2f offset(static_cast<float>(distributionX(mGenerator)), static_cast<float>(distributionY(mGenerator)));
-			SetTarget(mTargetFoodSource->GetCenterTarget() + offset);
+			SetTarget(foodSource->GetCenterTarget() + offset);
 		}
 
 		newPosition = sf::Vector2f(
-			mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-			mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+			Position().x + cos(rotationRadians) * Speed() * deltaTime,
+			Position().y + sin(rotationRadians) * Speed() * deltaTime);
 	}
 
-	mPosition = newPosition;
+	Position() = newPosition;
 
-	if (mHarvestingClock.getElapsedTime().asSeconds() >= mHarvestingDuration)
+	if (HarvestingTimeElapsed() >= mHarvestingDuration)
 	{	// Now we go back to finding a target
-		mFoodAmount += mTargetFoodSource->TakeFood(EXTRACTION_YIELD);
-		mTargeting = false;
-		mState = State::DeliveringFood;
-	}
-
-	SetColor(Bee::NORMAL_COLOR);
-	for (auto iter = FoodSourceManager::GetInstance()->Begin(); iter != FoodSourceManager::GetInstance()->End(); ++iter)
-	{
-		if (CollidingWithFoodSource(*(*iter)))
+		if (foodSource != nullptr)
 		{
-			SetColor(Bee::ALERT_COLOR);
-			break;
+			Defer([this, foodSource]() { FoodAmount() += foodSource->TakeFood(EXTRACTION_YIELD); });
 		}
+		mTargeting = false;
+		CurrentState() = State::DeliveringFood;
 	}
-
-	PostUpdate(newPosition, rotationAngle);
 }
 
-void OnlookerBee::UpdateDeliveringFood(sf::RenderWindow& window, const double& deltaTime)
+void OnlookerBee::UpdateDeliveringFood(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	float rotationAngle = rotationRadians * (180 / PI);
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
 
 	SetTarget(mParentHive.GetCenterTarget());
 	sf::Vector2f newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 	if (DistanceBetween(newPosition, mParentHive.GetCenterTarget()) <= TARGET_RADIUS)
 	{
-		mState = State::DepositingFood;
+		CurrentState() = State::DepositingFood;
 	}
 
-	PostUpdate(newPosition, rotationAngle);
+	Position() = newPosition;
 }
 
-void OnlookerBee::UpdateDepositingFood(sf::RenderWindow& window, const double& deltaTime)
+void OnlookerBee::UpdateDepositingFood(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	float rotationAngle = rotationRadians * (180 / PI);
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
 
-	sf::Vector2f newPosition = mPosition;
+	sf::Vector2f newPosition = Position();
 
-	if (DistanceBetween(mTarget, mPosition) <= TARGET_RADIUS)
+	if (DistanceBetween(Target(), Position()) <= TARGET_RADIUS)
 	{
 		auto dimensions = mParentHive.GetDimensions();
 		uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x / 2), static_cast<int>(dimensions.x / 2));
@@ -172,45 +164,19 @@ void OnlookerBee::UpdateDepositingFood(sf::RenderWindow& window, const double& d
 	}
 
 	newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 
-	mPosition = newPosition;
+	Position() = newPosition;
 
-	if (mHarvestingClock.getElapsedTime().asSeconds() >= mHarvestingDuration)
+	if (HarvestingTimeElapsed() >= mHarvestingDuration)
 	{	// Now we go back to finding a target
-		DepositFood(mFoodAmount);
 		mTargeting = false;
-		mState = State::Idle;
-		mParentHive.AddIdleBee(this);
-		SetColor(Bee::NORMAL_COLOR);
-	}
-
-	SetColor(Bee::NORMAL_COLOR);
-	for (auto iter = FoodSourceManager::GetInstance()->Begin(); iter != FoodSourceManager::GetInstance()->End(); ++iter)
-	{
-		if (CollidingWithFoodSource(*(*iter)))
+		CurrentState() = State::Idle;
+		Defer([this]()
 		{
-			SetColor(Bee::ALERT_COLOR);
-			break;
-		}
+			DepositFood(FoodAmount());
+			mParentHive.AddIdleBee(this);
+		});
 	}
-
-	PostUpdate(newPosition, rotationAngle);
-}
-
-void OnlookerBee::PostUpdate(const sf::Vector2f& newPosition, const float& rotationAngle)
-{
-	DetectStructureCollisions();
-	mPosition = newPosition;
-	mBody.setPosition(sf::Vector2f(mPosition.x - BodyRadius, mPosition.y - BodyRadius));
-	mFace.setPosition(mPosition.x, mPosition.y);
-	mFace.setRotation(rotationAngle);
-
-	stringstream ss;
-	ss << "Food: " << mFoodAmount;
-	mText.setString(ss.str());
-	mText.setPosition(mPosition - sf::Vector2f(mText.getLocalBounds().width / 2.0f, 35));
 }
-
-
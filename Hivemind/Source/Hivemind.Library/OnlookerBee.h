@@ -31,29 +31,29 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
-protected:
+#pragma region State Steps
 
-	void PopulateFunctionMaps() override;
+	// A full update for a bee already known to be in the named state. BeeManager buckets onlookers by state and
+	// calls these from one loop per state, so no per-bee dispatch is needed
+	void StepIdle(const double& deltaTime);
+	void StepSeekingTarget(const double& deltaTime);
+	void StepHarvestingFood(const double& deltaTime);
+	void StepDeliveringFood(const double& deltaTime);
+	void StepDepositingFood(const double& deltaTime);
 
-private:
+#pragma endregion
 
-	void UpdateIdle(sf::RenderWindow& window, const double& deltaTime);
-	void UpdateSeekingTarget(sf::RenderWindow& window, const double& deltaTime);
-	void UpdateHarvestingFood(sf::RenderWindow& window, const double& deltaTime);
-	void UpdateDeliveringFood(sf::RenderWindow& window, const double& deltaTime);
-	void UpdateDepositingFood(sf::RenderWindow& window, const double& deltaTime);
+private:
 
-	/**
-	 * Sets the position and rotation of the bee after computed in update
-	 * @Param newPosition: The bee's new position after update
-	 * @Param rotationAngle: The bee's new rotation after update
-	 */
-	void PostUpdate(const sf::Vector2f& newPosition, const float& rotationAngle);
+	void UpdateIdle(const double& deltaTime);
+	void UpdateSeekingTarget(const double& deltaTime);
+	void UpdateHarvestingFood(const double& deltaTime);
+	void UpdateDeliveringFood(const double& deltaTime);
+	void UpdateDepositingFood(const double& deltaTime);
 
 };
 
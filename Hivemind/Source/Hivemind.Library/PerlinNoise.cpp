@@ -2,10 +2,9 @@
 #include "PerlinNoise.h"
 
 
-PerlinNoise::PerlinNoise()
+PerlinNoise::PerlinNoise(const RandomStream& stream) :
+	mGenerator(stream)
 {
-	std::random_device device;
-	mGenerator = std::default_random_engine(device());
 }
 
 float** PerlinNoise::GenerateWhiteNoise(const sf::Vector2i& dimensions)
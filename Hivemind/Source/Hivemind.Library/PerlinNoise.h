@@ -1,5 +1,6 @@
 #pragma once
 #include <random>
+#include "RandomStream.h"
 #include <SFML/System/Vector2.hpp>
 
 
@@ -10,7 +11,11 @@ public:
 
 #pragma region Construction/Copy/Assignment
 
-	PerlinNoise();
+	/**
+	 * Constructor
+	 * @Param stream: The random stream the white noise is drawn from
+	 */
+	explicit PerlinNoise(const RandomStream& stream = RandomStream());
 
 	~PerlinNoise() = default;
 
@@ -60,7 +65,7 @@ private:
 	 */
 	static float Interpolate(float x0, float x1, float alpha);
 
-	std::default_random_engine mGenerator;
+	RandomStream mGenerator;
 
 };
 
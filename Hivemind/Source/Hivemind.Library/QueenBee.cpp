@@ -8,69 +8,33 @@ QueenBee::QueenBee(const sf::Vector2f& position, Hive& hive) :
 	Bee(position, hive),
 	mLarvaDepositInterval(5.0f), mTimeSinceLarvaDeposit(0.0f)
 {
-	mState = State::Idle;
+	CurrentState() = State::Idle;
 	mFillColor = sf::Color::Magenta;
-	mBody.setFillColor(mFillColor);
 }
 
-void QueenBee::Update(sf::RenderWindow& window, const double& deltaTime)
+void QueenBee::Update(const double& deltaTime)
 {
-	Bee::Update(window, deltaTime);
+	Bee::Update(deltaTime);
 
-	auto beeManager = BeeManager::GetInstance();
-
-	if (mEnergy <= 0.0f)
-	{
-		beeManager->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Queen);
-	}
+	Defer([this]()
+	{	// Starvation is only known once the meal queued by Bee::Update has been served
+		if (Energy() <= 0.0f)
+		{
+			BeeManager::GetInstance()->GetCommands().SpawnLarva(Position(), mParentHive, Larva::LarvaType::Queen);
+		}
+	});
 
 	mTimeSinceLarvaDeposit += deltaTime;
 	if (mTimeSinceLarvaDeposit >= mLarvaDepositInterval)
 	{
-		// Lay all eggs needed to maintain minimum bee values
-		if (mParentHive.GetBeeCount(Bee::Type::Onlooker) < 50)
-		{
-			beeManager->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Onlooker);
-		}
-		if (mParentHive.GetBeeCount(Bee::Type::Employee) < 10)
-		{
-			beeManager->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Employee);
-		}
-		if (mParentHive.GetBeeCount(Bee::Type::Drone) < 5)
-		{
-			beeManager->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Drone);
-		}
-		if (mParentHive.GetBeeCount(Bee::Type::Guard) < 5)
-		{
-			beeManager->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Guard);
-		}
-
-		uniform_int_distribution<int> distribution(0, 3);
-		auto roll = distribution(mGenerator);
-		switch (roll)
-		{
-		case 0:
-			BeeManager::GetInstance()->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Onlooker);
-			break;
-		case 1:
-			BeeManager::GetInstance()->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Employee);
-			break;
-		case 2:
-			BeeManager::GetInstance()->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Drone);
-			break;
-		case 3:
-			BeeManager::GetInstance()->SpawnLarva(mPosition, mParentHive, Larva::LarvaType::Guard);
-			break;
-		}
+		Defer([this]() { LayEggs(); });
 		mTimeSinceLarvaDeposit = 0.0f;
 	}
 
-	auto facePosition = mFace.getPosition();
-	float rotationRadians = atan2(mTarget.y - facePosition.y, mTarget.x - facePosition.x);
-	float rotationAngle = rotationRadians * (180 / PI);
-	sf::Vector2f newPosition = mPosition;
+	float rotationRadians = atan2(Target().y - Position().y, Target().x - Position().x);
+	sf::Vector2f newPosition = Position();
 
-	if (DistanceBetween(mTarget, mPosition) <= TARGET_RADIUS)
+	if (DistanceBetween(Target(), Position()) <= TARGET_RADIUS)
 	{
 		auto dimensions = mParentHive.GetDimensions();
 		uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x / 2), static_cast<int>(dimensions.x / 2));
@@ -80,17 +44,54 @@ void QueenBee::Update(sf::RenderWindow& window, const double& deltaTime)
 	}
 
 	newPosition = sf::Vector2f(
-		mPosition.x + cos(rotationRadians) * mSpeed * deltaTime,
-		mPosition.y + sin(rotationRadians) * mSpeed * deltaTime);
+		Position().x + cos(rotationRadians) * Speed() * deltaTime,
+		Position().y + sin(rotationRadians) * Speed() * deltaTime);
 
-	DetectStructureCollisions();
-	mPosition = newPosition;
-	mBody.setPosition(sf::Vector2f(mPosition.x - BodyRadius, mPosition.y - BodyRadius));
-	mFace.setPosition(mPosition.x, mPosition.y);
-	mFace.setRotation(rotationAngle);
+	Position() = newPosition;
 }
 
 void QueenBee::Render(sf::RenderWindow& window) const
 {
 	Bee::Render(window);
 }
+
+void QueenBee::LayEggs()
+{
+	auto& commands = BeeManager::GetInstance()->GetCommands();
+
+	// Lay all eggs needed to maintain minimum bee values
+	if (mParentHive.GetBeeCount(Bee::Type::Onlooker) < 50)
+	{
+		commands.SpawnLarva(Position(), mParentHive, Larva::LarvaType::Onlooker);
+	}
+	if (mParentHive.GetBeeCount(Bee::Type::Employee) < 10)
+	{
+		commands.SpawnLarva(Position(), mParentHive, Larva::LarvaType::Employee);
+	}
+	if (mParentHive.GetBeeCount(Bee::Type::Drone) < 5)
+	{
+		commands.SpawnLarva(Position(), mParentHive, Larva::LarvaType::Drone);
+	}
+	if (mParentHive.GetBeeCount(Bee::Type::Guard) < 5)
+	{
+		commands.SpawnLarva(Position(), mParentHive, Larva::LarvaType::Guard);
+	}
+
+	uniform_int_distribution<int> distribution(0, 3);
+	auto roll = distribution(mGenerator);
+	switch (roll)
+	{
+	case 0:
+		commands.SpawnLarva(Position(), mParentHive, Larva::LarvaType::Onlooker);
+		break;
+	case 1:
+		commands.SpawnLarva(Position(), mParentHive, Larva::LarvaType::Employee);
+		break;
+	case 2:
+		commands.SpawnLarva(Position(), mParentHive, Larva::LarvaType::Drone);
+		break;
+	case 3:
+		commands.SpawnLarva(Position(), mParentHive, Larva::LarvaType::Guard);
+		break;
+	}
+}
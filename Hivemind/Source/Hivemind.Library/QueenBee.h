@@ -31,10 +31,9 @@ public:
 
 	/**
 	 * Update method called by the main game loop
-	 * @Param window: The window that the simulation is being rendered to
 	 * @Param deltaTime: The time since the last Update call
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 * Render method called by the main game loop
@@ -42,13 +41,13 @@ public:
 	 */
 	void Render(sf::RenderWindow& window) const override;
 
-protected:
-	
-	// Bees don't operate on state so we don't need to use the function map
-	void PopulateFunctionMaps() override {}
-
 private:
 
+	/**
+	 * Lays the larva needed to keep the hive at its minimum population, plus one of a random type
+	 */
+	void LayEggs();
+
 	float mLarvaDepositInterval;
 	float mTimeSinceLarvaDeposit;
 
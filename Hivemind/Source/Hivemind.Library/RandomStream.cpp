@@ -0,0 +1,48 @@
+#include "pch.h"
+#include "RandomStream.h"
+
+
+using namespace std;
+
+namespace
+{
+	const uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+}
+
+RandomStream::RandomStream() :
+	RandomStream(0, Domain::WorldGenerator, 0)
+{
+}
+
+RandomStream::RandomStream(const uint64_t& seed, const Domain& domain, const uint64_t& id) :
+	mKey(Mix(Mix(Mix(seed) ^ (static_cast<uint64_t>(domain) + 1) * GOLDEN_GAMMA) ^ id)), mCounter(0)
+{
+}
+
+RandomStream::RandomStream(const uint64_t& key) :
+	mKey(key), mCounter(0)
+{
+}
+
+RandomStream RandomStream::Fork(const uint64_t& id) const
+{
+	return RandomStream(Mix(mKey ^ Mix(id + GOLDEN_GAMMA)));
+}
+
+RandomStream::result_type RandomStream::operator()()
+{
+	return Mix(mKey + Mix(mCounter++));
+}
+
+uint64_t RandomStream::GetCounter() const
+{
+	return mCounter;
+}
+
+uint64_t RandomStream::Mix(uint64_t value)
+{
+	value += GOLDEN_GAMMA;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
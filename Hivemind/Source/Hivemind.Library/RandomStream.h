@@ -0,0 +1,96 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+
+/**
+ * Counter-based random number generator. Every value is a pure function of the stream's key and the number of
+ * values drawn so far, so two streams derived from the same world seed and identity always produce the same
+ * sequence no matter when, or on which thread, they are created. Satisfies UniformRandomBitGenerator so it can
+ * be handed to any of the std distributions in place of std::default_random_engine
+ */
+class RandomStream
+{
+
+public:
+
+	typedef std::uint64_t result_type;
+
+	/**
+	 * The subsystem a stream belongs to. Streams of different domains never share a key,
+	 * even when they are created with the same id
+	 */
+	enum Domain
+	{
+		WorldGenerator,
+		FlowField,
+		Hive,
+		Bee,
+		Wasp,
+		WaspManager
+	};
+
+#pragma region Construction/Copy/Assignment
+
+	/**
+	 * Default constructor. Creates a stream from a seed of zero
+	 */
+	RandomStream();
+
+	/**
+	 * Constructor
+	 * @Param seed: The world seed the stream is derived from
+	 * @Param domain: The subsystem the stream belongs to
+	 * @Param id: Identity of the entity or system within its domain
+	 */
+	explicit RandomStream(const std::uint64_t& seed, const Domain& domain, const std::uint64_t& id);
+
+	~RandomStream() = default;
+
+	RandomStream(const RandomStream& rhs) = default;
+
+	RandomStream& operator=(const RandomStream& rhs) = default;
+
+#pragma endregion
+
+	/**
+	 * Derives an independent child stream. The child depends only on this stream's key and the id,
+	 * never on how many values have already been drawn from this stream
+	 * @Param id: Identity of the child within this stream
+	 * @Return: The child stream
+	 */
+	RandomStream Fork(const std::uint64_t& id) const;
+
+	/**
+	 * Draws the next value from the stream
+	 * @Return: A uniformly distributed 64 bit value
+	 */
+	result_type operator()();
+
+	/**
+	 * Accessor method for the number of values drawn from the stream
+	 * @Return: The position of the stream
+	 */
+	std::uint64_t GetCounter() const;
+
+	static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+	static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+private:
+
+	/**
+	 * Constructor used when forking, where the key has already been derived
+	 * @Param key: The key of the new stream
+	 */
+	explicit RandomStream(const std::uint64_t& key);
+
+	/**
+	 * SplitMix64 finalizer. Scrambles the bits of a value so that neighboring inputs produce unrelated outputs
+	 * @Param value: The value being mixed
+	 * @Return: The mixed value
+	 */
+	static std::uint64_t Mix(std::uint64_t value);
+
+	std::uint64_t mKey;
+	std::uint64_t mCounter;
+};
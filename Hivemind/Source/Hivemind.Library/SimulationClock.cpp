@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "SimulationClock.h"
+
+
+using namespace std;
+
+const double SimulationClock::DEFAULT_TIMESTEP = 1.0 / 60.0;
+const uint32_t SimulationClock::DEFAULT_MAX_STEPS_PER_FRAME = 1000;
+
+SimulationClock::SimulationClock(const double& timestep) :
+	mTimestep(timestep), mTimeScale(1.0), mAccumulator(0.0), mElapsedTime(0.0), mTickCount(0),
+	mMaxStepsPerFrame(DEFAULT_MAX_STEPS_PER_FRAME)
+{
+	assert(mTimestep > 0.0);
+}
+
+uint32_t SimulationClock::Accumulate(const double& realDeltaTime)
+{
+	mAccumulator += realDeltaTime * mTimeScale;
+
+	uint32_t steps = static_cast<uint32_t>(min(mAccumulator / mTimestep, static_cast<double>(mMaxStepsPerFrame)));
+	mAccumulator -= steps * mTimestep;
+
+	if (steps == mMaxStepsPerFrame)
+	{	// We can't keep up, so drop the backlog rather than asking for even more work next frame
+		mAccumulator = 0.0;
+	}
+
+	return steps;
+}
+
+void SimulationClock::Step()
+{
+	mTickCount++;
+	mElapsedTime += mTimestep;
+}
+
+void SimulationClock::Reset()
+{
+	mAccumulator = 0.0;
+	mElapsedTime = 0.0;
+	mTickCount = 0;
+}
+
+double SimulationClock::GetElapsedTime() const
+{
+	return mElapsedTime;
+}
+
+uint64_t SimulationClock::GetTickCount() const
+{
+	return mTickCount;
+}
+
+double SimulationClock::GetTimestep() const
+{
+	return mTimestep;
+}
+
+void SimulationClock::SetTimestep(const double& timestep)
+{
+	assert(timestep > 0.0);
+	mTimestep = timestep;
+}
+
+double SimulationClock::GetTimeScale() const
+{
+	return mTimeScale;
+}
+
+void SimulationClock::SetTimeScale(const double& timeScale)
+{
+	mTimeScale = max(timeScale, 0.0);
+}
+
+void SimulationClock::SetMaxStepsPerFrame(const uint32_t& maxStepsPerFrame)
+{
+	mMaxStepsPerFrame = maxStepsPerFrame;
+}
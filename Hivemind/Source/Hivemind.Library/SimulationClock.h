@@ -0,0 +1,100 @@
+#pragma once
+
+
+class SimulationClock
+{
+
+public:
+
+	const static double DEFAULT_TIMESTEP;
+	const static std::uint32_t DEFAULT_MAX_STEPS_PER_FRAME;
+
+#pragma region Construction/Copy/Assignment
+
+	/**
+	 * Constructor
+	 * @Param timestep: The fixed amount of simulation time that passes with every step
+	 */
+	explicit SimulationClock(const double& timestep = DEFAULT_TIMESTEP);
+
+	~SimulationClock() = default;
+
+	SimulationClock(const SimulationClock& rhs) = delete;
+
+	SimulationClock& operator=(const SimulationClock& rhs) = delete;
+
+	SimulationClock(SimulationClock&& rhs) = delete;
+
+	SimulationClock& operator=(SimulationClock&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Banks real time that has passed since the last frame, scaled by the time scale, and determines how many
+	 * fixed steps are now due. Any backlog beyond the max steps per frame is dropped so a slow frame can not spiral
+	 * @Param realDeltaTime: The wall clock time since the last call
+	 * @Return: The number of fixed steps that should be simulated this frame
+	 */
+	std::uint32_t Accumulate(const double& realDeltaTime);
+
+	/**
+	 * Advances the simulation time by a single fixed step
+	 */
+	void Step();
+
+	/**
+	 * Resets the elapsed simulation time, tick count and any banked time back to zero
+	 */
+	void Reset();
+
+	/**
+	 * Accessor method for the total simulation time that has elapsed
+	 * @Return: The number of simulated seconds since the clock was last reset
+	 */
+	double GetElapsedTime() const;
+
+	/**
+	 * Accessor method for the number of steps that have been simulated
+	 * @Return: The number of steps since the clock was last reset
+	 */
+	std::uint64_t GetTickCount() const;
+
+	/**
+	 * Accessor method for the fixed step size
+	 * @Return: The amount of simulation time that passes with every step
+	 */
+	double GetTimestep() const;
+
+	/**
+	 * Mutator method for the fixed step size
+	 * @Param timestep: The amount of simulation time that passes with every step
+	 */
+	void SetTimestep(const double& timestep);
+
+	/**
+	 * Accessor method for the time scale
+	 * @Return: How many simulated seconds pass for every real second
+	 */
+	double GetTimeScale() const;
+
+	/**
+	 * Mutator method for the time scale. Values above one warp the simulation by running several steps per frame
+	 * @Param timeScale: How many simulated seconds pass for every real second
+	 */
+	void SetTimeScale(const double& timeScale);
+
+	/**
+	 * Mutator method for the cap on how many steps a single frame may request
+	 * @Param maxStepsPerFrame: The maximum number of steps returned by Accumulate
+	 */
+	void SetMaxStepsPerFrame(const std::uint32_t& maxStepsPerFrame);
+
+private:
+
+	double mTimestep;
+	double mTimeScale;
+	double mAccumulator;
+	double mElapsedTime;
+	std::uint64_t mTickCount;
+	std::uint32_t mMaxStepsPerFrame;
+};
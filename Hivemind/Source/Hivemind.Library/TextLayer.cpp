@@ -0,0 +1,69 @@
+#include "pch.h"
+#include "TextLayer.h"
+
+
+using namespace std;
+
+const float TextLayer::REFRESH_INTERVAL = 1.0f / 60.0f;
+
+TextLayer::TextLayer(const unsigned& characterSize) :
+	mLabels(), mStream(), mCharacterSize(characterSize), mTime(0.0), mFrame(0), mLayoutCount(0)
+{
+}
+
+void TextLayer::BeginFrame(const double& deltaTime)
+{
+	mTime += deltaTime;
+	mLayoutCount = 0;
+
+	for (auto iter = mLabels.begin(); iter != mLabels.end();)
+	{
+		if (iter->second.mDrawnFrame != mFrame)
+		{	// Scrolled out of view, so it is laid out afresh if it comes back
+			iter = mLabels.erase(iter);
+		}
+		else
+		{
+			++iter;
+		}
+	}
+	++mFrame;
+}
+
+uint32_t TextLayer::GetLabelCount() const
+{
+	return static_cast<uint32_t>(mLabels.size());
+}
+
+uint32_t TextLayer::GetLayoutCount() const
+{
+	return mLayoutCount;
+}
+
+TextLayer::Label& TextLayer::FindLabel(const uint64_t& key, bool& created)
+{
+	auto iter = mLabels.find(key);
+	if (iter != mLabels.end())
+	{
+		return iter->second;
+	}
+
+	created = true;
+	auto& label = mLabels[key];
+	label.mText.setFont(FontManager::GetInstance()->Hack());
+	label.mText.setCharacterSize(mCharacterSize);
+	label.mText.setOutlineColor(sf::Color::White);
+	label.mText.setFillColor(sf::Color::White);
+	label.mValues.fill(0);
+	label.mLaidOutAt = mTime;
+	label.mDrawnFrame = mFrame;
+	return label;
+}
+
+void TextLayer::Layout(Label& label, const Values& values)
+{
+	label.mText.setString(mStream.str());
+	label.mValues = values;
+	label.mLaidOutAt = mTime;
+	++mLayoutCount;
+}
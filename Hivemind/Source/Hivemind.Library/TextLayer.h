@@ -0,0 +1,133 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <unordered_map>
+#include <SFML/Graphics.hpp>
+
+
+/**
+ * A set of labels that keep their laid out text between frames. Each label is identified by a key and shows up to
+ * four numbers, and its string is only formatted and laid out again when those numbers change, at most once per
+ * REFRESH_INTERVAL. Labels are only touched when drawn, so anything off screen costs nothing, and a label that goes
+ * a whole frame without being drawn is dropped
+ */
+class TextLayer
+{
+
+public:
+
+	/**
+	 * The numbers a label shows. Unused entries should be left at zero
+	 */
+	typedef std::array<std::uint32_t, 4> Values;
+
+	/**
+	 * The shortest time between two layouts of the same label, in seconds. Matches a 60Hz display, so a value that
+	 * changes every tick of a warped simulation is laid out no more often than it can be seen
+	 */
+	const static float REFRESH_INTERVAL;
+
+#pragma region Construction/Copy/Assignment
+
+	/**
+	 * Constructor
+	 * @Param characterSize: The size of every label's text
+	 */
+	explicit TextLayer(const unsigned& characterSize);
+
+	~TextLayer() = default;
+
+	TextLayer(const TextLayer& rhs) = delete;
+
+	TextLayer& operator=(const TextLayer& rhs) = delete;
+
+	TextLayer(TextLayer&& rhs) = delete;
+
+	TextLayer& operator=(TextLayer&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Starts a new frame, dropping every label that was not drawn during the last one
+	 * @Param deltaTime: The wall clock time since the last frame began
+	 */
+	void BeginFrame(const double& deltaTime);
+
+	/**
+	 * Draws a label, laying it out first if it is new or its values have changed since it was last laid out
+	 * @Param target: The target being drawn to
+	 * @Param key: Identifies the label across frames
+	 * @Param position: The top left corner of the label, in world units
+	 * @Param values: The numbers the label shows
+	 * @Param format: Callable taking a std::ostream&, which writes the label's string. Only called on layout
+	 */
+	template <typename Formatter>
+	void Draw(sf::RenderTarget& target, const std::uint64_t& key, const sf::Vector2f& position, const Values& values,
+		const Formatter& format);
+
+	/**
+	 * Accessor method for the number of labels kept between frames
+	 * @Return: The number of labels drawn during the last frame
+	 */
+	std::uint32_t GetLabelCount() const;
+
+	/**
+	 * Accessor method for the number of labels laid out during the current frame
+	 * @Return: The number of labels whose string was formatted since BeginFrame
+	 */
+	std::uint32_t GetLayoutCount() const;
+
+private:
+
+	struct Label
+	{
+		sf::Text mText;
+		Values mValues;
+		double mLaidOutAt;
+		std::uint64_t mDrawnFrame;
+	};
+
+	/**
+	 * Finds the label for a key, creating and styling it if there is none
+	 * @Param key: Identifies the label across frames
+	 * @Param created: Set to true if the label did not exist yet
+	 * @Return: The label for the key
+	 */
+	Label& FindLabel(const std::uint64_t& key, bool& created);
+
+	/**
+	 * Replaces a label's string with whatever was written to the layer's stream
+	 * @Param label: The label being laid out
+	 * @Param values: The numbers the new string shows
+	 */
+	void Layout(Label& label, const Values& values);
+
+	std::unordered_map<std::uint64_t, Label> mLabels;
+	std::ostringstream mStream;
+	unsigned mCharacterSize;
+	double mTime;
+	std::uint64_t mFrame;
+	std::uint32_t mLayoutCount;
+
+};
+
+template <typename Formatter>
+void TextLayer::Draw(sf::RenderTarget& target, const std::uint64_t& key, const sf::Vector2f& position,
+	const Values& values, const Formatter& format)
+{
+	bool created = false;
+	auto& label = FindLabel(key, created);
+	label.mDrawnFrame = mFrame;
+
+	if (created || (label.mValues != values && mTime - label.mLaidOutAt >= REFRESH_INTERVAL))
+	{
+		mStream.str(std::string());
+		mStream.clear();
+		format(static_cast<std::ostream&>(mStream));
+		Layout(label, values);
+	}
+
+	label.mText.setPosition(position);
+	target.draw(label.mText);
+}
@@ -0,0 +1,151 @@
+#include "pch.h"
+#include "ThreadPool.h"
+
+
+using namespace std;
+
+const uint32_t ThreadPool::DEFAULT_GRAIN_SIZE = 64;
+
+ThreadPool::ThreadPool(const uint32_t& threadCount) :
+	mThreadCount(threadCount > 0 ? threadCount : 1), mWorkers(), mQueues(), mTask(nullptr), mCount(0), mGrainSize(DEFAULT_GRAIN_SIZE),
+	mGeneration(0), mBusyWorkers(0), mStopping(false)
+{
+	StartWorkers();
+}
+
+ThreadPool::~ThreadPool()
+{
+	StopWorkers();
+}
+
+void ThreadPool::ParallelFor(const uint32_t& count, const function<void(uint32_t)>& task, const uint32_t& grainSize)
+{
+	ParallelForRange(count, [&task](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			task(i);
+		}
+	}, grainSize);
+}
+
+void ThreadPool::ParallelForRange(const uint32_t& count, const function<void(uint32_t, uint32_t)>& task, const uint32_t& grainSize)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	mGrainSize = grainSize > 0 ? grainSize : 1;
+	uint32_t chunkCount = (count + mGrainSize - 1) / mGrainSize;
+
+	if (mThreadCount == 1 || chunkCount == 1)
+	{	// Not worth waking anyone up
+		task(0, count);
+		return;
+	}
+
+	for (uint32_t i = 0; i < mThreadCount; ++i)
+	{	// Deal an even share of chunks to every worker
+		mQueues[i].mNext.store(static_cast<uint32_t>(static_cast<uint64_t>(chunkCount) * i / mThreadCount), memory_order_relaxed);
+		mQueues[i].mEnd = static_cast<uint32_t>(static_cast<uint64_t>(chunkCount) * (i + 1) / mThreadCount);
+	}
+
+	{
+		lock_guard<mutex> lock(mMutex);
+		mTask = &task;
+		mCount = count;
+		mBusyWorkers = static_cast<uint32_t>(mWorkers.size());
+		mGeneration++;
+	}
+	mWorkAvailable.notify_all();
+
+	RunChunks(0);
+
+	unique_lock<mutex> lock(mMutex);
+	mWorkComplete.wait(lock, [this]() { return mBusyWorkers == 0; });
+	mTask = nullptr;
+}
+
+uint32_t ThreadPool::GetThreadCount() const
+{
+	return mThreadCount;
+}
+
+void ThreadPool::SetThreadCount(const uint32_t& threadCount)
+{
+	StopWorkers();
+	mThreadCount = threadCount > 0 ? threadCount : 1;
+	StartWorkers();
+}
+
+void ThreadPool::StartWorkers()
+{
+	mStopping = false;
+	mQueues.reset(new ChunkQueue[mThreadCount]);
+	for (uint32_t i = 0; i < mThreadCount; ++i)
+	{
+		mQueues[i].mNext.store(0);
+		mQueues[i].mEnd = 0;
+	}
+
+	for (uint32_t i = 1; i < mThreadCount; ++i)
+	{	// Worker zero is whichever thread calls ParallelFor
+		mWorkers.emplace_back(&ThreadPool::WorkerLoop, this, i, mGeneration);
+	}
+}
+
+void ThreadPool::StopWorkers()
+{
+	{
+		lock_guard<mutex> lock(mMutex);
+		mStopping = true;
+	}
+	mWorkAvailable.notify_all();
+
+	for (auto iter = mWorkers.begin(); iter != mWorkers.end(); ++iter)
+	{
+		iter->join();
+	}
+	mWorkers.clear();
+}
+
+void ThreadPool::WorkerLoop(const uint32_t index, uint64_t lastGeneration)
+{
+	while (true)
+	{
+		{
+			unique_lock<mutex> lock(mMutex);
+			mWorkAvailable.wait(lock, [&]() { return mStopping || mGeneration != lastGeneration; });
+			if (mStopping)
+			{
+				return;
+			}
+			lastGeneration = mGeneration;
+		}
+
+		RunChunks(index);
+
+		{
+			lock_guard<mutex> lock(mMutex);
+			mBusyWorkers--;
+		}
+		mWorkComplete.notify_one();
+	}
+}
+
+void ThreadPool::RunChunks(const uint32_t index)
+{
+	const auto& task = *mTask;
+	for (uint32_t offset = 0; offset < mThreadCount; ++offset)
+	{	// Start with our own queue, then walk the others looking for leftovers to steal
+		auto& queue = mQueues[(index + offset) % mThreadCount];
+		uint32_t chunk;
+		while ((chunk = queue.mNext.fetch_add(1, memory_order_relaxed)) < queue.mEnd)
+		{
+			uint32_t begin = chunk * mGrainSize;
+			uint32_t end = begin + mGrainSize < mCount ? begin + mGrainSize : mCount;
+			task(begin, end);
+		}
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/**
+ * Fixed set of worker threads for data parallel loops. Each call to ParallelFor splits the index range into chunks
+ * and deals every worker an even share. A worker that runs out of its own chunks steals the remaining chunks of the
+ * others, so uneven per-item cost does not leave cores idle. The calling thread participates as worker zero
+ */
+class ThreadPool
+{
+
+public:
+
+	const static std::uint32_t DEFAULT_GRAIN_SIZE;
+
+#pragma region Construction/Copy/Assignment
+
+	/**
+	 * Constructor
+	 * @Param threadCount: The total number of threads, including the calling thread, that loops will run on
+	 */
+	explicit ThreadPool(const std::uint32_t& threadCount = 1);
+
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool& rhs) = delete;
+
+	ThreadPool& operator=(const ThreadPool& rhs) = delete;
+
+	ThreadPool(ThreadPool&& rhs) = delete;
+
+	ThreadPool& operator=(ThreadPool&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Invokes the task once for every index in [0, count), spread across all threads. Returns once every index is done
+	 * @Param count: The number of indices to process
+	 * @Param task: The work to do for a single index. Must be safe to call concurrently for different indices
+	 * @Param grainSize: The number of consecutive indices handed out at once
+	 */
+	void ParallelFor(const std::uint32_t& count, const std::function<void(std::uint32_t)>& task,
+		const std::uint32_t& grainSize = DEFAULT_GRAIN_SIZE);
+
+	/**
+	 * Invokes the task once per chunk of [0, count), spread across all threads. Lets tight loops run without a call
+	 * through std::function for every index. Returns once every chunk is done
+	 * @Param count: The number of indices to process
+	 * @Param task: The work to do for the indices [begin, end). Must be safe to call concurrently for different chunks
+	 * @Param grainSize: The number of consecutive indices a thread claims at once
+	 */
+	void ParallelForRange(const std::uint32_t& count, const std::function<void(std::uint32_t, std::uint32_t)>& task,
+		const std::uint32_t& grainSize = DEFAULT_GRAIN_SIZE);
+
+	/**
+	 * Accessor method for the number of threads loops run on
+	 * @Return: The thread count, including the calling thread
+	 */
+	std::uint32_t GetThreadCount() const;
+
+	/**
+	 * Mutator method for the number of threads loops run on. Joins and respawns the workers
+	 * @Param threadCount: The thread count, including the calling thread. Zero is treated as one
+	 */
+	void SetThreadCount(const std::uint32_t& threadCount);
+
+private:
+
+	/**
+	 * The chunks dealt to a single worker. Other workers advance mNext directly when stealing. Padded by hand to a
+	 * cache line, since plain new does not honour over-aligned types before C++17, so neighbouring queues in the
+	 * array never share the line their counters sit on
+	 */
+	struct ChunkQueue
+	{
+		std::atomic<std::uint32_t> mNext;
+		std::uint32_t mEnd;
+		char mPadding[64 - sizeof(std::atomic<std::uint32_t>) - sizeof(std::uint32_t)];
+	};
+
+	/**
+	 * Starts the background workers
+	 */
+	void StartWorkers();
+
+	/**
+	 * Signals the background workers to exit and joins them
+	 */
+	void StopWorkers();
+
+	/**
+	 * Entry point of every background worker
+	 * @Param index: The worker's index into the chunk queues
+	 * @Param lastGeneration: The loop generation at the time the worker was started, so earlier loops are not rerun
+	 */
+	void WorkerLoop(const std::uint32_t index, std::uint64_t lastGeneration);
+
+	/**
+	 * Drains the worker's own chunks, then steals from every other worker until no chunks remain
+	 * @Param index: The worker's index into the chunk queues
+	 */
+	void RunChunks(const std::uint32_t index);
+
+	std::uint32_t mThreadCount;
+	std::vector<std::thread> mWorkers;
+	std::unique_ptr<ChunkQueue[]> mQueues;
+
+	// Current loop
+	const std::function<void(std::uint32_t, std::uint32_t)>* mTask;
+	std::uint32_t mCount;
+	std::uint32_t mGrainSize;
+
+	// Synchronization
+	std::mutex mMutex;
+	std::condition_variable mWorkAvailable;
+	std::condition_variable mWorkComplete;
+	std::uint64_t mGeneration;
+	std::uint32_t mBusyWorkers;
+	bool mStopping;
+};
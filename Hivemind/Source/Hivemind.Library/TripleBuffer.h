@@ -0,0 +1,114 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+
+/**
+ * Hands values from one producing thread to one consuming thread without either waiting on the other. The producer
+ * fills its own slot and publishes it, the consumer reads the most recently published slot, and a third slot holds
+ * whichever value is waiting between the two. Publishing only swaps indices, so the producer can run ahead of the
+ * consumer, skipping values it never reads, and the consumer can redraw the same value as often as it likes.
+ * Slots are reused rather than reallocated, so a value that keeps its storage when refilled stops allocating
+ */
+template <typename T>
+class TripleBuffer
+{
+
+public:
+
+#pragma region Construction/Copy/Assignment
+
+	TripleBuffer();
+
+	~TripleBuffer() = default;
+
+	TripleBuffer(const TripleBuffer& rhs) = delete;
+
+	TripleBuffer& operator=(const TripleBuffer& rhs) = delete;
+
+	TripleBuffer(TripleBuffer&& rhs) = delete;
+
+	TripleBuffer& operator=(TripleBuffer&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Accessor method for the producer's slot. Only the producing thread may call this
+	 * @Return: The slot being filled, which still holds whatever value was last published from it
+	 */
+	T& WriteBuffer();
+
+	/**
+	 * Makes the producer's slot the latest value and hands the producer the slot waiting in the middle. Only the
+	 * producing thread may call this
+	 */
+	void Publish();
+
+	/**
+	 * Accessor method for the consumer's slot, first taking the latest published value if there is a new one. Only
+	 * the consuming thread may call this
+	 * @Return: The most recently published value, which the producer will not touch until the next call
+	 */
+	const T& ReadBuffer();
+
+	/**
+	 * Accessor method for the number of values published so far
+	 * @Return: The number of calls to Publish
+	 */
+	std::uint64_t GetPublishCount() const;
+
+private:
+
+	static const std::uint32_t SLOT_COUNT = 3;
+
+	T mSlots[SLOT_COUNT];
+	std::uint32_t mWriteSlot;
+	std::uint32_t mReadySlot;
+	std::uint32_t mReadSlot;
+	bool mFresh;
+	std::uint64_t mPublishCount;
+	mutable std::mutex mMutex;
+
+};
+
+template <typename T>
+TripleBuffer<T>::TripleBuffer() :
+	mSlots(), mWriteSlot(0), mReadySlot(1), mReadSlot(2), mFresh(false), mPublishCount(0), mMutex()
+{
+}
+
+template <typename T>
+T& TripleBuffer<T>::WriteBuffer()
+{
+	return mSlots[mWriteSlot];
+}
+
+template <typename T>
+void TripleBuffer<T>::Publish()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	std::swap(mWriteSlot, mReadySlot);
+	mFresh = true;
+	mPublishCount++;
+}
+
+template <typename T>
+const T& TripleBuffer<T>::ReadBuffer()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (mFresh)
+	{
+		std::swap(mReadSlot, mReadySlot);
+		mFresh = false;
+	}
+
+	return mSlots[mReadSlot];
+}
+
+template <typename T>
+std::uint64_t TripleBuffer<T>::GetPublishCount() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mPublishCount;
+}
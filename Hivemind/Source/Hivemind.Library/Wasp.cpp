@@ -5,13 +5,12 @@
 using namespace std;
 
 const float Wasp::StandardWaspSpeed = 300.0f;
+const float Wasp::HiveDetectionRadius = 500.0f;
 
-Wasp::Wasp(const sf::Vector2f& position):
+Wasp::Wasp(const sf::Vector2f& position, const uint64_t& id):
 	Entity(position, sf::Color(196, 196, 196), sf::Color::Red),
-	mState(State::Wandering), mGenerator(), mTargetHive(nullptr)
+	mState(State::Wandering), mGenerator(World::GetInstance()->CreateStream(RandomStream::Wasp, id)), mTargetHive(), mHandle()
 {
-	std::random_device device;
-	mGenerator = std::default_random_engine(device());
 	GenerateNewTarget();
 
 	mBody.setRadius(Bee::BodyRadius);
@@ -23,22 +22,24 @@ Wasp::Wasp(const sf::Vector2f& position):
 
 Wasp::~Wasp()
 {
+	if (mCollisionNode != nullptr)
+	{
+		mCollisionNode->UnregisterWasp(this);
+	}
 }
 
-void Wasp::Update(sf::RenderWindow& window, const double& deltaTime)
+void Wasp::Update(const double& deltaTime)
 {
 	switch (mState)
 	{
 		case State::Wandering:
-			UpdateWanderingState(window, deltaTime);
+			UpdateWanderingState(deltaTime);
 			break;
 		case State::Attacking:
-			UpdateAttackingState(window, deltaTime);
+			UpdateAttackingState(deltaTime);
 			break;
 	}
 
-	mBody.setPosition(mPosition);
-
 	if (mCollisionNode != nullptr && !mCollisionNode->ContainsPoint(mPosition))
 	{	// If we haev a collision node and we leave it, invalidate the pointer
 		mCollisionNode->UnregisterWasp(this);
@@ -52,11 +53,23 @@ void Wasp::Update(sf::RenderWindow& window, const double& deltaTime)
 	}
 }
 
+void Wasp::AddToSnapshot(WorldSnapshot& snapshot) const
+{
+	WorldSnapshot::WaspState state;
+	state.mPosition = mPosition;
+	snapshot.AddWasp(state);
+}
+
 void Wasp::Render(sf::RenderWindow& window) const
 {
 	window.draw(mBody);
 }
 
+void Wasp::UpdatePresentation()
+{
+	mBody.setPosition(mPosition);
+}
+
 void Wasp::GenerateNewTarget()
 {
 	uniform_real_distribution<float> distribution(-500.0f, 500.0f);
@@ -64,39 +77,57 @@ void Wasp::GenerateNewTarget()
 	mTarget = mPosition + offset;
 }
 
-void Wasp::UpdateWanderingState(sf::RenderWindow& window, const double& deltaTime)
+void Wasp::UpdateWanderingState(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
-
 	float rotationRadians = atan2(mTarget.y - mPosition.y, mTarget.x - mPosition.x);
 	mPosition.x += (cos(rotationRadians) * StandardWaspSpeed * deltaTime);
 	mPosition.y += (sin(rotationRadians) * StandardWaspSpeed * deltaTime);
 
-	if (DistanceBetween(mPosition, mTarget) <= mBody.getRadius())
+	if (DistanceBetween(mPosition, mTarget) <= Bee::BodyRadius)
 	{
 		GenerateNewTarget();
 	}
 
-	auto hiveManager = HiveManager::GetInstance();
-	for (auto iter = hiveManager->Begin(); iter != hiveManager->End(); ++iter)
+	// Hives register in the cell of their top left corner, so the search box reaches a full hive further than the
+	// detection range up and to the left
+	sf::Vector2f reach(HiveDetectionRadius, HiveDetectionRadius);
+	sf::Vector2f extent(Hive::STANDARD_WIDTH, Hive::STANDARD_HEIGHT);
+	auto detectionRadiusSquared = HiveDetectionRadius * HiveDetectionRadius;
+
+	Hive* targetHive = nullptr;
+	CollisionGrid::GetInstance()->QueryRegion(mPosition - reach - extent, mPosition + reach,
+		[this, &targetHive, &detectionRadiusSquared](const CollisionNode& node)
 	{
-		auto target = (*iter)->GetCenterTarget();
-		if (DistanceBetween(mPosition, target) < 500.0f)
-		{
-			mTargetHive = (*iter);
-			mTarget = target;
-			mState = State::Attacking;
-			break;
+		auto& hives = node.Hives();
+		for (auto iter = hives.begin(); iter != hives.end(); ++iter)
+		{	// Prefer the earliest spawned hive so the choice does not depend on which cell was visited first
+			if (targetHive != nullptr && targetHive->GetHandle() < (*iter)->GetHandle())
+			{
+				continue;
+			}
+			if (DistanceSquaredBetween(mPosition, (*iter)->GetCenterTarget()) < detectionRadiusSquared)
+			{
+				targetHive = *iter;
+			}
 		}
+		return false;
+	});
+
+	if (targetHive != nullptr)
+	{
+		mTargetHive = targetHive->GetHandle();
+		mTarget = targetHive->GetCenterTarget();
+		mState = State::Attacking;
+		targetHive->AddThreat(mHandle);
 	}
 }
 
-void Wasp::UpdateAttackingState(sf::RenderWindow& window, const double& deltaTime)
+void Wasp::UpdateAttackingState(const double& deltaTime)
 {
-	UNREFERENCED_PARAMETER(window);
 	UNREFERENCED_PARAMETER(deltaTime);
 
-	assert(mTargetHive != nullptr);
+	auto targetHive = GetTargetHive();
+	assert(targetHive != nullptr);
 
 	float rotationRadians = atan2(mTarget.y - mPosition.y, mTarget.x - mPosition.x);
 	mPosition.x += (cos(rotationRadians) * StandardWaspSpeed * deltaTime);
@@ -104,15 +135,20 @@ void Wasp::UpdateAttackingState(sf::RenderWindow& window, const double& deltaTim
 
 	if (DistanceBetween(mTarget, mPosition) <= Bee::TARGET_RADIUS)
 	{
-		auto dimensions = mTargetHive->GetDimensions();
+		auto dimensions = targetHive->GetDimensions();
 		uniform_int_distribution<int> distributionX(static_cast<int>(-dimensions.x / 2), static_cast<int>(dimensions.x / 2));
 		uniform_int_distribution<int> distributionY(static_cast<int>(-dimensions.y / 2), static_cast<int>(dimensions.y / 2));
 		sf::Vector2f offset(static_cast<float>(distributionX(mGenerator)), static_cast<float>(distributionY(mGenerator)));
-		mTarget = mTargetHive->GetCenterTarget() + offset;
+		mTarget = targetHive->GetCenterTarget() + offset;
 	}
 }
 
 Hive* Wasp::GetTargetHive() const
 {
-	return mTargetHive;
+	return HiveManager::GetInstance()->FindHive(mTargetHive);
+}
+
+const Handle<Wasp>& Wasp::GetHandle() const
+{
+	return mHandle;
 }
@@ -1,13 +1,19 @@
 #pragma once
 #include "Entity.h"
+#include "RandomStream.h"
+#include "Handle.h"
 
 
+class Hive;
+class WorldSnapshot;
+
 class Wasp : public Entity
 {
 
 public:
 
 	const static float StandardWaspSpeed;
+	const static float HiveDetectionRadius;
 
 	enum State
 	{
@@ -20,8 +26,9 @@ public:
 	/**
 	 * Constructor
 	 * @Param position: The starting position of the wasp
+	 * @Param id: Identity of the wasp, used to derive its random stream from the world seed
 	 */
-	explicit Wasp(const sf::Vector2f& position);
+	explicit Wasp(const sf::Vector2f& position, const std::uint64_t& id = 0);
 
 	virtual ~Wasp();
 
@@ -37,10 +44,9 @@ public:
 
 	/**
 	 * Updates the wasp's current state
-	 * @Param window: The screen which the wasp is being rendered to
 	 * @Param deltaTime: The time since last update call on the wasp
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime) override;
+	void Update(const double& deltaTime) override;
 
 	/**
 	 * Renders the wasp to the specified screen
@@ -48,14 +54,33 @@ public:
 	 */
 	void Render(sf::RenderWindow& window) const override;
 
+	/**
+	 * Moves the wasp's body to its position
+	 */
+	void UpdatePresentation() override;
+
+	/**
+	 * Copies the wasp's position into a snapshot of the world
+	 * @Param snapshot: The snapshot being captured, whose current cell is the one the wasp is registered in
+	 */
+	void AddToSnapshot(WorldSnapshot& snapshot) const;
+
 	/**
 	 * Accessor for the hive that the wasp is currently attacking, if any
 	 * @Return: A pointer to the hive being attacked, if any. Nullptr otherwise
 	 */
 	Hive* GetTargetHive() const;
 
+	/**
+	 * Accessor method for the handle the WaspManager issued for this wasp
+	 * @Return: The wasp's handle. Null if the wasp was not spawned by the manager
+	 */
+	const Handle<Wasp>& GetHandle() const;
+
 private:
 
+	friend class WaspManager;
+
 	/**
 	 * Generates a new random target for the wasp to pursue
 	 */
@@ -63,22 +88,21 @@ private:
 
 	/**
 	* Updates the wasp's current state while wandering
-	* @Param window: The screen which the wasp is being rendered to
 	* @Param deltaTime: The time since last update call on the wasp
 	*/
-	void UpdateWanderingState(sf::RenderWindow& window, const double& deltaTime);
+	void UpdateWanderingState(const double& deltaTime);
 
 	/**
 	* Updates the wasp's current state while attacking
-	* @Param window: The screen which the wasp is being rendered to
 	* @Param deltaTime: The time since last update call on the wasp
 	*/
-	void UpdateAttackingState(sf::RenderWindow& window, const double& deltaTime);
+	void UpdateAttackingState(const double& deltaTime);
 
 	sf::CircleShape mBody;
 	State mState;
 	sf::Vector2f mTarget;
-	std::default_random_engine mGenerator;
-	Hive* mTargetHive;
+	RandomStream mGenerator;
+	Handle<Hive> mTargetHive;
+	Handle<Wasp> mHandle;
 };
 
@@ -5,38 +5,44 @@
 using namespace std;
 
 WaspManager* WaspManager::sInstance = nullptr;
+const uint32_t WaspManager::DEFAULT_WASP_CAP = 50;
 
 WaspManager::WaspManager():
-	mTimeSinceSpawn(0.0f)
+	mPool(), mHandles(), mWaspCap(DEFAULT_WASP_CAP), mGenerator(World::GetInstance()->CreateStream(RandomStream::WaspManager)), mSpawnCount(0), mTimeSinceSpawn(0.0f)
 {
-	std::random_device device;
-	mGenerator = std::default_random_engine(device());
 }
 
 void WaspManager::CleanupWasps()
 {
-	bool waspRemoved = true;
-	while (waspRemoved)
+	auto survivor = mWasps.begin();
+	for (auto iter = mWasps.begin(); iter != mWasps.end(); ++iter)
 	{
-		waspRemoved = false;
-		for (auto iter = mWasps.begin(); iter != mWasps.end(); ++iter)
+		if ((*iter)->MarkedForDelete())
+		{
+			mGraveyard.push_back(*iter);
+		}
+		else
 		{
-			if ((*iter)->MarkedForDelete())
-			{
-				delete (*iter);
-				mWasps.erase(iter);
-				waspRemoved = true;
-				break;
-			}
+			*survivor = *iter;
+			++survivor;
 		}
 	}
+	mWasps.erase(survivor, mWasps.end());
+
+	for (auto iter = mGraveyard.begin(); iter != mGraveyard.end(); ++iter)
+	{
+		mHandles.Release((*iter)->mHandle);
+		mPool.Destroy(*iter);
+	}
+	mGraveyard.clear();
 }
 
 WaspManager::~WaspManager()
 {
 	for (auto iter = mWasps.begin(); iter != mWasps.end(); ++iter)
 	{
-		delete (*iter);
+		mHandles.Release((*iter)->mHandle);
+		mPool.Destroy(*iter);
 	}
 	mWasps.clear();
 }
@@ -60,10 +66,10 @@ std::vector<Wasp*>::iterator WaspManager::End()
 	return mWasps.end();
 }
 
-void WaspManager::Update(sf::RenderWindow& window, const double& deltaTime)
+void WaspManager::Update(const double& deltaTime)
 {
 	mTimeSinceSpawn += deltaTime;
-	if (mTimeSinceSpawn >= mSpawnInterval && mWasps.size() <= 50)
+	if (mTimeSinceSpawn >= mSpawnInterval && mWasps.size() <= mWaspCap)
 	{
 		mTimeSinceSpawn = 0.0f;
 		uniform_real_distribution<float> distribution(-10000.0f, 10000.0f);
@@ -72,23 +78,42 @@ void WaspManager::Update(sf::RenderWindow& window, const double& deltaTime)
 
 	for (auto iter = mWasps.begin(); iter != mWasps.end(); ++iter)
 	{
-		(*iter)->Update(window, deltaTime);
+		(*iter)->Update(deltaTime);
 	}
 
 	CleanupWasps();
 }
 
-void WaspManager::Render(sf::RenderWindow& window) const
+void WaspManager::SpawnWasp(const sf::Vector2f& position)
 {
-	for (auto iter = mWasps.begin(); iter != mWasps.end(); ++iter)
-	{
-		(*iter)->Render(window);
-	}
+	auto wasp = mPool.Create(position, mSpawnCount++);
+	wasp->mHandle = mHandles.Issue(wasp);
+	mWasps.push_back(wasp);
 }
 
-void WaspManager::SpawnWasp(const sf::Vector2f& position)
+std::uint32_t WaspManager::GetWaspCount() const
+{
+	return static_cast<std::uint32_t>(mWasps.size());
+}
+
+const PoolStatistics& WaspManager::GetPoolStatistics() const
+{
+	return mPool.GetStatistics();
+}
+
+void WaspManager::SetWaspCap(const std::uint32_t& waspCap)
+{
+	mWaspCap = waspCap;
+}
+
+std::uint32_t WaspManager::GetWaspCap() const
+{
+	return mWaspCap;
+}
+
+Wasp* WaspManager::FindWasp(const Handle<Wasp>& handle) const
 {
-	mWasps.push_back(new Wasp(position));
+	return mHandles.Find(handle);
 }
 
 void WaspManager::DestroyWasp(Wasp* const wasp)
@@ -97,7 +122,8 @@ void WaspManager::DestroyWasp(Wasp* const wasp)
 	{
 		if (*iter == wasp)
 		{
-			delete *iter;
+			mHandles.Release(wasp->mHandle);
+			mPool.Destroy(*iter);
 			mWasps.erase(iter);
 			break;
 		}
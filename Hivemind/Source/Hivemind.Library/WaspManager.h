@@ -1,4 +1,6 @@
 #pragma once
+#include "Wasp.h"
+#include "ObjectPool.h"
 
 
 class WaspManager
@@ -24,6 +26,8 @@ public:
 
 #pragma endregion
 
+	static const std::uint32_t DEFAULT_WASP_CAP;
+
 	/**
 	 * Singleton accessor method
 	 * @Return: A pointer to the WaspManager instance
@@ -45,12 +49,7 @@ public:
 	/**
 	 * Disseminates update calls to all spawned wasps
 	 */
-	void Update(sf::RenderWindow& window, const double& deltaTime);
-
-	/**
-	 * Disseminates render calls to all spawned wasps
-	 */
-	void Render(sf::RenderWindow& window) const;
+	void Update(const double& deltaTime);
 
 	/**
 	 * Spawns a wasp at the specified location
@@ -63,18 +62,54 @@ public:
 	 */
 	void DestroyWasp(Wasp* const wasp);
 
+	/**
+	 * Accessor method for the size of the wasp list
+	 * @Return: The total number of wasps in the simulation
+	 */
+	std::uint32_t GetWaspCount() const;
+
+	/**
+	 * Accessor method for the allocation counters of the wasp pool
+	 * @Return: The capacity, live count, high-water mark and recycle counts of the pool
+	 */
+	const PoolStatistics& GetPoolStatistics() const;
+
+	/**
+	 * Mutator method for the wasp cap. Wasps keep spawning while there are no more than this many
+	 * @Param waspCap: The new cap
+	 */
+	void SetWaspCap(const std::uint32_t& waspCap);
+
+	/**
+	 * Accessor method for the wasp cap
+	 * @Return: The number of wasps above which no more are spawned
+	 */
+	std::uint32_t GetWaspCap() const;
+
+	/**
+	 * Resolves a handle issued by this manager
+	 * @Param handle: The handle of the wasp being looked up
+	 * @Return: A pointer to the wasp, or nullptr if the handle is null or stale
+	 */
+	Wasp* FindWasp(const Handle<Wasp>& handle) const;
+
 private:
 
 	/**
-	 * Iterates over all wasps and removes them if they are marked for delete
+	 * Removes every wasp marked for delete in one stable pass, then destroys them
 	 */
 	void CleanupWasps();
 	
 	static WaspManager* sInstance;
 
+	ObjectPool<Wasp> mPool;
+	HandleTable<Wasp> mHandles;
 	std::vector<Wasp*> mWasps;
+	std::vector<Wasp*> mGraveyard;
 	const float mSpawnInterval = 5.0f;
-	std::default_random_engine mGenerator;
+	std::uint32_t mWaspCap;
+	RandomStream mGenerator;
+	std::uint64_t mSpawnCount;
 	float mTimeSinceSpawn;
 
 };
@@ -0,0 +1,126 @@
+#include "pch.h"
+#include "World.h"
+#include "WorldGenerator.h"
+
+
+using namespace std;
+
+World* World::sInstance = nullptr;
+
+World::World() :
+	mClock(), mThreadPool(thread::hardware_concurrency()), mSnapshots(), mSeed(0), mHeadless(false)
+{
+}
+
+World::~World()
+{
+}
+
+World* World::GetInstance()
+{
+	if (sInstance == nullptr)
+	{
+		sInstance = new World();
+	}
+
+	return sInstance;
+}
+
+void World::Load(const string& path)
+{
+	// The generator reads the world seed, so it must run before any other system draws random numbers
+	WorldGenerator::GetInstance()->Generate(path);
+	FlowFieldManager::GetInstance();
+	CollisionGrid::GetInstance();
+	WaspManager::GetInstance();
+
+	if (!mHeadless)
+	{
+		PublishSnapshot();
+	}
+}
+
+uint32_t World::Update(const double& realDeltaTime)
+{
+	auto steps = mClock.Accumulate(realDeltaTime);
+	for (uint32_t i = 0; i < steps; ++i)
+	{
+		Step();
+	}
+
+	// Only the last step is published, so at a high time scale the renderer skips the steps in between
+	if (!mHeadless && steps > 0)
+	{
+		PublishSnapshot();
+	}
+
+	return steps;
+}
+
+void World::Step()
+{
+	auto deltaTime = mClock.GetTimestep();
+	HiveManager::GetInstance()->Update(static_cast<float>(deltaTime));
+	BeeManager::GetInstance()->Update(static_cast<float>(deltaTime));
+	FoodSourceManager::GetInstance()->Update(static_cast<float>(deltaTime));
+	WaspManager::GetInstance()->Update(deltaTime);
+	BeeManager::GetInstance()->FlushCommands();
+	CollisionGrid::GetInstance()->ReleaseEmptyNodes();
+	mClock.Step();
+}
+
+SimulationClock& World::GetClock()
+{
+	return mClock;
+}
+
+const SimulationClock& World::GetClock() const
+{
+	return mClock;
+}
+
+void World::PublishSnapshot()
+{
+	mSnapshots.WriteBuffer().Capture();
+	mSnapshots.Publish();
+}
+
+const WorldSnapshot& World::ReadSnapshot()
+{
+	return mSnapshots.ReadBuffer();
+}
+
+uint64_t World::GetSeed() const
+{
+	return mSeed;
+}
+
+void World::SetSeed(const uint64_t& seed)
+{
+	mSeed = seed;
+}
+
+RandomStream World::CreateStream(const RandomStream::Domain& domain, const uint64_t& id) const
+{
+	return RandomStream(mSeed, domain, id);
+}
+
+ThreadPool& World::GetThreadPool()
+{
+	return mThreadPool;
+}
+
+void World::SetThreadCount(const uint32_t& threadCount)
+{
+	mThreadPool.SetThreadCount(threadCount);
+}
+
+bool World::IsHeadless() const
+{
+	return mHeadless;
+}
+
+void World::SetHeadless(const bool headless)
+{
+	mHeadless = headless;
+}
@@ -0,0 +1,144 @@
+#pragma once
+#include "SimulationClock.h"
+#include "RandomStream.h"
+#include "ThreadPool.h"
+#include "TripleBuffer.h"
+#include "WorldSnapshot.h"
+
+
+class World
+{
+
+public:
+
+	/**
+	 * Singleton accessor
+	 * @Return: A pointer to the instance of the singleton
+	 */
+	static World* GetInstance();
+
+#pragma region Construction/Copy/Assignment
+
+private:
+
+	World();
+
+public:
+
+	~World();
+
+	World(const World& rhs) = delete;
+
+	World& operator=(const World& rhs) = delete;
+
+	World(World&& rhs) = delete;
+
+	World& operator=(World&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Populates the simulation from a world config file. Unless headless, the first snapshot is published before this
+	 * returns, so the renderer always has a world to draw
+	 * @Param path: The path of the json file containing the world data
+	 */
+	void Load(const std::string& path);
+
+	/**
+	 * Banks the real time since the last frame on the simulation clock and runs however many fixed steps are due.
+	 * With a time scale above one this runs several steps per frame. Unless headless, a snapshot of the world is
+	 * published once the steps are done, if there were any
+	 * @Param realDeltaTime: The wall clock time since the last Update call
+	 * @Return: The number of steps that were simulated
+	 */
+	std::uint32_t Update(const double& realDeltaTime);
+
+	/**
+	 * Advances every system in the simulation by a single fixed step. Nothing here touches the window,
+	 * so the same call drives both the desktop front end and the headless runner
+	 */
+	void Step();
+
+	/**
+	 * Accessor method for the simulation clock that drives every timer in the world
+	 * @Return: A reference to the simulation clock
+	 */
+	SimulationClock& GetClock();
+
+	/**
+	 * Accessor method for the simulation clock that drives every timer in the world
+	 * @Return: A const reference to the simulation clock
+	 */
+	const SimulationClock& GetClock() const;
+
+	/**
+	 * Captures the current state of the world into a snapshot and hands it to the renderer. Must be called between
+	 * steps, on the thread that runs the simulation
+	 */
+	void PublishSnapshot();
+
+	/**
+	 * Accessor method for the most recently published snapshot. Only the thread that renders may call this, and the
+	 * snapshot stays valid and unchanged until its next call
+	 * @Return: The latest state of the world that is safe to draw
+	 */
+	const WorldSnapshot& ReadSnapshot();
+
+	/**
+	 * Accessor method for the world seed
+	 * @Return: The seed every random stream in the simulation is derived from
+	 */
+	std::uint64_t GetSeed() const;
+
+	/**
+	 * Mutator method for the world seed. Must be called before any entity is spawned
+	 * @Param seed: The seed every random stream in the simulation will be derived from
+	 */
+	void SetSeed(const std::uint64_t& seed);
+
+	/**
+	 * Derives a random stream from the world seed. The same domain and id always yield the same stream for a
+	 * given seed, regardless of spawn order or which thread asks for it
+	 * @Param domain: The subsystem requesting the stream
+	 * @Param id: Identity of the entity or system within its domain
+	 * @Return: A new random stream
+	 */
+	RandomStream CreateStream(const RandomStream::Domain& domain, const std::uint64_t& id = 0) const;
+
+	/**
+	 * Accessor method for the pool that entity updates are spread across
+	 * @Return: A reference to the world's thread pool
+	 */
+	ThreadPool& GetThreadPool();
+
+	/**
+	 * Mutator method for the number of threads entity updates are spread across. The simulation produces the
+	 * same result for any thread count
+	 * @Param threadCount: The number of threads to use, including the main thread
+	 */
+	void SetThreadCount(const std::uint32_t& threadCount);
+
+	/**
+	 * Accessor for whether the simulation is running without a window
+	 * @Return: True if nothing will ever be rendered
+	 */
+	bool IsHeadless() const;
+
+	/**
+	 * Marks the simulation as headless. Must be called before the world is loaded so that
+	 * render-only resources, such as fonts, are never requested
+	 * @Param headless: True if the simulation will run without a window
+	 */
+	void SetHeadless(const bool headless);
+
+private:
+
+	// Singleton instance
+	static World* sInstance;
+
+	SimulationClock mClock;
+	ThreadPool mThreadPool;
+	TripleBuffer<WorldSnapshot> mSnapshots;
+	std::uint64_t mSeed;
+	bool mHeadless;
+};
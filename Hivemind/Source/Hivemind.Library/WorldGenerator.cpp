@@ -8,10 +8,8 @@ using namespace rapidjson;
 WorldGenerator* WorldGenerator::sInstance = nullptr;
 
 WorldGenerator::WorldGenerator():
-	mData()
+	mData(), mGenerator()
 {
-	std::random_device device;
-	mGenerator = std::default_random_engine(device());
 }
 
 WorldGenerator* WorldGenerator::GetInstance()
@@ -46,6 +44,25 @@ void WorldGenerator::Generate(const std::string& path)
 
 	mData.Parse(json.c_str());
 
+	auto world = World::GetInstance();
+	if (mData.HasMember("Seed"))
+	{	// A seeded world replays identically on every run
+		assert(mData["Seed"].IsUint64());
+		world->SetSeed(mData["Seed"].GetUint64());
+	}
+	else
+	{	// Unseeded worlds still get a single seed up front, so the run can be reproduced from GetSeed
+		std::random_device device;
+		world->SetSeed((static_cast<uint64_t>(device()) << 32) | device());
+	}
+	mGenerator = world->CreateStream(RandomStream::WorldGenerator);
+
+	if (mData.HasMember("CollisionCellSize"))
+	{	// Cells are allocated on demand, so only their size needs configuring
+		assert(mData["CollisionCellSize"].IsInt());
+		CollisionGrid::GetInstance()->SetNodeSize(mData["CollisionCellSize"].GetInt());
+	}
+
 	GenerateHives();
 	GenerateFoodSources();
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <rapidjson/document.h>
+#include "RandomStream.h"
 
 
 class WorldGenerator
@@ -85,6 +86,6 @@ private:
 	 * Base-level data object for the world data
 	 */
 	rapidjson::Document mData;
-	std::default_random_engine mGenerator;
+	RandomStream mGenerator;
 };
 
@@ -0,0 +1,301 @@
+#include "pch.h"
+#include "WorldRenderer.h"
+
+
+using namespace std;
+
+const float WorldRenderer::POINT_ZOOM = 1.5f;
+const float WorldRenderer::HEATMAP_ZOOM = 6.0f;
+const float WorldRenderer::RENDER_MARGIN = 400.0f;
+
+WorldRenderer::HiveDisplay::HiveDisplay(const WorldSnapshot::HiveState& state) :
+	mState(state),
+	mHUD(mState.mPosition + sf::Vector2f(-(mState.mDimensions.x / 2.0f), mState.mDimensions.y + 30),
+		sf::Vector2f(mState.mDimensions.x * 2, 20), mState.mOnlookerCount, mState.mEmployeeCount, mState.mDroneCount,
+		mState.mGuardCount, mState.mQueenCount, mState.mStructuralComb, mState.mHoneyComb, mState.mBroodComb,
+		mState.mFoodAmount)
+{
+}
+
+WorldRenderer::WorldRenderer() :
+	mBeeRenderer(), mDensityMap(), mHiveDisplays(), mHUDVertices(), mHUDHives(), mVisibleHives(), mStructures(), mHiveBody(), mFoodSourceBody(), mCellBorder(), mWaspBody(),
+	mFoodSourceLabels(16), mCellLabels(64), mFrameClock(), mDetail(Detail::Bodies), mDrawnHiveCount(0),
+	mDrawnFoodSourceCount(0), mDrawnWaspCount(0), mGridVisible(false)
+{
+	// Every entity of a kind looks the same apart from its position and state, so one shape is moved between them
+	mHiveBody.setOutlineThickness(14);
+	mHiveBody.setOutlineColor(sf::Color(196, 196, 196));
+	mHiveBody.setFillColor(sf::Color(222, 147, 12));
+
+	mFoodSourceBody.setOutlineThickness(14);
+	mFoodSourceBody.setOutlineColor(sf::Color(196, 196, 196));
+
+	mCellBorder.setOutlineThickness(-40);
+	mCellBorder.setOutlineColor(sf::Color(255, 255, 255, 32));
+	mCellBorder.setFillColor(sf::Color::Transparent);
+
+	mWaspBody.setRadius(Bee::BodyRadius);
+	mWaspBody.setFillColor(sf::Color::Red);
+	mWaspBody.setOutlineColor(sf::Color(196, 196, 196));
+	mWaspBody.setOutlineThickness(-2);
+}
+
+void WorldRenderer::Render(sf::RenderWindow& window, const WorldSnapshot& snapshot)
+{
+	auto& view = window.getView();
+	auto visibleArea = VisibleArea(view);
+	auto zoom = view.getSize().x / static_cast<float>(window.getSize().x);
+	auto deltaTime = mFrameClock.restart().asSeconds();
+	mFoodSourceLabels.BeginFrame(deltaTime);
+	mCellLabels.BeginFrame(deltaTime);
+
+	RenderHives(window, snapshot, visibleArea);
+	RenderFoodSources(window, snapshot, visibleArea);
+	RenderBees(window, snapshot, visibleArea, zoom);
+	if (mGridVisible)
+	{
+		RenderGrid(window, snapshot, visibleArea);
+	}
+	RenderWasps(window, snapshot, visibleArea);
+}
+
+sf::FloatRect WorldRenderer::VisibleArea(const sf::View& view)
+{
+	// Views may be rotated, but this simulation never rotates its own, so the view's size is its extent in the world
+	auto extent = view.getSize() + sf::Vector2f(RENDER_MARGIN, RENDER_MARGIN) * 2.0f;
+	auto corner = view.getCenter() - extent / 2.0f;
+	return sf::FloatRect(corner, extent);
+}
+
+void WorldRenderer::ToggleGridVisualization()
+{
+	mGridVisible = !mGridVisible;
+}
+
+WorldRenderer::Detail WorldRenderer::GetDetail() const
+{
+	return mDetail;
+}
+
+uint32_t WorldRenderer::GetDrawnHiveCount() const
+{
+	return mDrawnHiveCount;
+}
+
+uint32_t WorldRenderer::GetDrawnFoodSourceCount() const
+{
+	return mDrawnFoodSourceCount;
+}
+
+uint32_t WorldRenderer::GetDrawnBeeCount() const
+{
+	return mBeeRenderer.GetBeeCount();
+}
+
+uint32_t WorldRenderer::GetDrawnWaspCount() const
+{
+	return mDrawnWaspCount;
+}
+
+void WorldRenderer::RenderHives(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area)
+{
+	mDrawnHiveCount = 0;
+	mVisibleHives.clear();
+	bool hudChanged = false;
+	snapshot.QueryVisible(area, [this, &window, &snapshot, &hudChanged](const WorldSnapshot::CellState& cell)
+	{
+		for (auto i = cell.mFirstHive; i < cell.mFirstHive + cell.mHiveCount; ++i)
+		{
+			const auto& hive = snapshot.Hives()[i];
+			mHiveBody.setPosition(hive.mPosition);
+			mHiveBody.setSize(hive.mDimensions);
+			window.draw(mHiveBody);
+
+			auto& display = HiveDisplayFor(hive);
+			display.mState = hive;
+			hudChanged |= display.mHUD.UpdateHUDValues();
+			mVisibleHives.push_back(hive.mId);
+			++mDrawnHiveCount;
+		}
+	});
+
+	// The batch is only rebuilt when a HUD in it changed or a hive came into or went out of view
+	if (hudChanged || mVisibleHives != mHUDHives)
+	{
+		mHUDVertices.clear();
+		for (auto id : mVisibleHives)
+		{
+			mHiveDisplays[id]->mHUD.AppendVertices(mHUDVertices);
+		}
+		swap(mHUDHives, mVisibleHives);
+	}
+
+	if (!mHUDVertices.empty())
+	{
+		window.draw(mHUDVertices.data(), mHUDVertices.size(), sf::Triangles);
+	}
+}
+
+void WorldRenderer::RenderFoodSources(sf::RenderWindow& window, const WorldSnapshot& snapshot,
+	const sf::FloatRect& area)
+{
+	mDrawnFoodSourceCount = 0;
+	snapshot.QueryVisible(area, [this, &window, &snapshot](const WorldSnapshot::CellState& cell)
+	{
+		for (auto i = cell.mFirstFoodSource; i < cell.mFirstFoodSource + cell.mFoodSourceCount; ++i)
+		{
+			const auto& foodSource = snapshot.FoodSources()[i];
+			mFoodSourceBody.setPosition(foodSource.mPosition);
+			mFoodSourceBody.setSize(foodSource.mDimensions);
+			mFoodSourceBody.setFillColor(sf::Color(32,
+				static_cast<sf::Uint8>(32 + 96 * (foodSource.mFoodAmount / foodSource.mMaxFoodAmount)), 32));
+			window.draw(mFoodSourceBody);
+
+			// Food is shown in whole units, so a trickle of harvesting does not lay the label out every frame
+			TextLayer::Values values = { static_cast<uint32_t>(foodSource.mFoodAmount), 0, 0, 0 };
+			mFoodSourceLabels.Draw(window, foodSource.mId, foodSource.mPosition + sf::Vector2f(30, 0), values,
+				[&values](ostream& stream)
+			{
+				stream << "Food: " << values[0];
+			});
+			++mDrawnFoodSourceCount;
+		}
+	});
+}
+
+void WorldRenderer::RenderBees(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area,
+	const float& zoom)
+{
+	mBeeRenderer.Clear();
+	mDetail = (zoom >= HEATMAP_ZOOM) ? Detail::Heatmap : (zoom >= POINT_ZOOM) ? Detail::Points : Detail::Bodies;
+
+	if (mDetail == Detail::Heatmap)
+	{	// No bee is visited, only the cells whose bee count changed since the last frame
+		mDensityMap.Update(snapshot, area);
+		mDensityMap.Render(window);
+		return;
+	}
+
+	// Every bee in view is added to one batch, so the visible colony takes one draw call
+	snapshot.QueryVisible(area, [this, &snapshot, &zoom](const WorldSnapshot::CellState& cell)
+	{
+		if (mDetail == Detail::Points)
+		{	// The square is kept at least a pixel wide so the bee does not vanish
+			for (auto i = cell.mFirstBee; i < cell.mFirstBee + cell.mBeeCount; ++i)
+			{
+				const auto& bee = snapshot.Bees()[i];
+				mBeeRenderer.AddPoint(bee.mPosition, max(bee.mRadius, zoom), bee.mFillColor);
+			}
+			return;
+		}
+
+		if (cell.mBeeCount > 0)
+		{
+			FindStructuresAround(snapshot, cell);
+		}
+		for (auto i = cell.mFirstBee; i < cell.mFirstBee + cell.mBeeCount; ++i)
+		{
+			const auto& bee = snapshot.Bees()[i];
+			auto heading = atan2(bee.mTarget.y - bee.mPosition.y, bee.mTarget.x - bee.mPosition.x);
+			auto& outlineColor = TouchingStructure(bee.mPosition) ? Bee::ALERT_COLOR : Bee::NORMAL_COLOR;
+			mBeeRenderer.AddBee(bee.mPosition, bee.mRadius, bee.mFillColor, outlineColor, bee.mFaceLength, heading);
+		}
+	});
+	mBeeRenderer.Render(window);
+}
+
+void WorldRenderer::RenderGrid(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area)
+{
+	auto cellSize = static_cast<float>(snapshot.GetCellSize());
+	mCellBorder.setSize(sf::Vector2f(cellSize, cellSize));
+	snapshot.QueryVisible(area, [this, &window, &cellSize](const WorldSnapshot::CellState& cell)
+	{
+		auto position = sf::Vector2f(cell.mCell) * cellSize;
+		mCellBorder.setPosition(position);
+		window.draw(mCellBorder);
+
+		TextLayer::Values values = { cell.mHiveCount, cell.mFoodSourceCount, cell.mBeeCount, cell.mWaspCount };
+		mCellLabels.Draw(window, CollisionGrid::KeyFromCell(cell.mCell), position + sf::Vector2f(50, 50), values,
+			[&values](ostream& stream)
+		{
+			stream << "Hives: " << values[0] << endl;
+			stream << "Food Sources: " << values[1] << endl;
+			stream << "Bees: " << values[2] << endl;
+			stream << "Wasps: " << values[3] << endl;
+		});
+	});
+}
+
+void WorldRenderer::RenderWasps(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area)
+{
+	mDrawnWaspCount = 0;
+	snapshot.QueryVisible(area, [this, &window, &snapshot](const WorldSnapshot::CellState& cell)
+	{
+		for (auto i = cell.mFirstWasp; i < cell.mFirstWasp + cell.mWaspCount; ++i)
+		{
+			mWaspBody.setPosition(snapshot.Wasps()[i].mPosition);
+			window.draw(mWaspBody);
+			++mDrawnWaspCount;
+		}
+	});
+}
+
+void WorldRenderer::FindStructuresAround(const WorldSnapshot& snapshot, const WorldSnapshot::CellState& cell)
+{
+	// Matches Bee::DetectStructureCollisions: hives registered in the bee's own cell, food sources in the cells around it
+	mStructures.clear();
+	for (auto i = cell.mFirstHive; i < cell.mFirstHive + cell.mHiveCount; ++i)
+	{
+		const auto& hive = snapshot.Hives()[i];
+		mStructures.emplace_back(hive.mPosition, hive.mDimensions);
+	}
+
+	for (int y = cell.mCell.y - 1; y <= cell.mCell.y + 1; ++y)
+	{
+		for (int x = cell.mCell.x - 1; x <= cell.mCell.x + 1; ++x)
+		{
+			auto neighbor = snapshot.FindCell(sf::Vector2i(x, y));
+			if (neighbor == nullptr)
+			{
+				continue;
+			}
+
+			for (auto i = neighbor->mFirstFoodSource; i < neighbor->mFirstFoodSource + neighbor->mFoodSourceCount; ++i)
+			{
+				const auto& foodSource = snapshot.FoodSources()[i];
+				mStructures.emplace_back(foodSource.mPosition, foodSource.mDimensions);
+			}
+		}
+	}
+}
+
+bool WorldRenderer::TouchingStructure(const sf::Vector2f& position) const
+{
+	for (auto iter = mStructures.begin(); iter != mStructures.end(); ++iter)
+	{
+		if ((position.x + Bee::BodyRadius > iter->left) &&
+			(position.x - Bee::BodyRadius < iter->left + iter->width) &&
+			(position.y + Bee::BodyRadius > iter->top) &&
+			(position.y - Bee::BodyRadius < iter->top + iter->height))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+WorldRenderer::HiveDisplay& WorldRenderer::HiveDisplayFor(const WorldSnapshot::HiveState& hive)
+{
+	if (hive.mId >= mHiveDisplays.size())
+	{
+		mHiveDisplays.resize(hive.mId + 1);
+	}
+
+	auto& display = mHiveDisplays[hive.mId];
+	if (display == nullptr)
+	{	// Hives never move, so the HUD is laid out once where the hive was first seen
+		display.reset(new HiveDisplay(hive));
+	}
+
+	return *display;
+}
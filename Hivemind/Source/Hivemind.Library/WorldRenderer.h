@@ -0,0 +1,217 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "WorldSnapshot.h"
+#include "BeeRenderer.h"
+#include "DensityMap.h"
+#include "HiveHUD.h"
+#include "TextLayer.h"
+
+
+/**
+ * Draws snapshots of the world. The renderer never touches a live entity, so it can run on a different thread, and
+ * at a different rate, from the simulation that publishes the snapshots. Only the cells in view are drawn, so a
+ * zoomed in frame costs the same whatever the size of the world, and bees are drawn in less detail as the view
+ * zooms out. Labels are kept laid out between frames and only formatted again when the numbers they show change, and
+ * the HUDs of every hive in view are drawn from one batch that is only rebuilt when one of them changes
+ */
+class WorldRenderer
+{
+
+public:
+
+	/**
+	 * How bees are drawn, from closest to farthest zoom
+	 */
+	enum Detail
+	{
+		Bodies,
+		Points,
+		Heatmap
+	};
+
+	/**
+	 * The zoom, in world units per pixel, beyond which bees are drawn as squares instead of full bodies
+	 */
+	const static float POINT_ZOOM;
+
+	/**
+	 * The zoom, in world units per pixel, beyond which individual bees are replaced by a heatmap of their density
+	 */
+	const static float HEATMAP_ZOOM;
+
+	/**
+	 * How far past the edges of the view the renderer looks for entities, in world units. Structures register with
+	 * the collision cell under their top left corner and hive HUDs hang below and beside their hive, so an entity can
+	 * be partly in view while its cell is not
+	 */
+	const static float RENDER_MARGIN;
+
+#pragma region Construction/Copy/Assignment
+
+	WorldRenderer();
+
+	~WorldRenderer() = default;
+
+	WorldRenderer(const WorldRenderer& rhs) = delete;
+
+	WorldRenderer& operator=(const WorldRenderer& rhs) = delete;
+
+	WorldRenderer(WorldRenderer&& rhs) = delete;
+
+	WorldRenderer& operator=(WorldRenderer&& rhs) = delete;
+
+#pragma endregion
+
+	/**
+	 * Draws a snapshot through the window's current view. The level of detail bees are drawn at is judged by how many
+	 * world units each pixel of the window covers
+	 * @Param window: The window that the snapshot is being rendered to
+	 * @Param snapshot: The state of the world being drawn
+	 */
+	void Render(sf::RenderWindow& window, const WorldSnapshot& snapshot);
+
+	/**
+	 * Determines the part of the world a view shows, widened by RENDER_MARGIN on every side
+	 * @Param view: The view the world is being rendered through
+	 * @Return: The area whose cells are drawn, in world units
+	 */
+	static sf::FloatRect VisibleArea(const sf::View& view);
+
+	/**
+	 *  Toggles the outline and entity counts of every collision cell in view
+	 */
+	void ToggleGridVisualization();
+
+	/**
+	 * Accessor method for the level of detail the last render call drew bees at
+	 * @Return: Whether bees were drawn as bodies, as squares or as a heatmap
+	 */
+	Detail GetDetail() const;
+
+	/**
+	 * Accessor method for the number of hives drawn by the last render call
+	 * @Return: The number of hives found in view
+	 */
+	std::uint32_t GetDrawnHiveCount() const;
+
+	/**
+	 * Accessor method for the number of food sources drawn by the last render call
+	 * @Return: The number of food sources found in view
+	 */
+	std::uint32_t GetDrawnFoodSourceCount() const;
+
+	/**
+	 * Accessor method for the number of bees drawn by the last render call
+	 * @Return: The number of bees found in view, or zero if they were drawn as a heatmap
+	 */
+	std::uint32_t GetDrawnBeeCount() const;
+
+	/**
+	 * Accessor method for the number of wasps drawn by the last render call
+	 * @Return: The number of wasps found in view
+	 */
+	std::uint32_t GetDrawnWaspCount() const;
+
+private:
+
+	/**
+	 * A hive's HUD, bound to the copy of the hive's state it was last drawn with
+	 */
+	struct HiveDisplay
+	{
+		explicit HiveDisplay(const WorldSnapshot::HiveState& state);
+
+		WorldSnapshot::HiveState mState;
+		HiveHUD mHUD;
+	};
+
+	/**
+	 * Draws every hive in view, then the HUDs of those hives with one draw call
+	 * @Param window: The window that the snapshot is being rendered to
+	 * @Param snapshot: The state of the world being drawn
+	 * @Param area: The part of the world in view, in world units
+	 */
+	void RenderHives(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area);
+
+	/**
+	 * Draws every food source in view, shaded by how much food it has left
+	 * @Param window: The window that the snapshot is being rendered to
+	 * @Param snapshot: The state of the world being drawn
+	 * @Param area: The part of the world in view, in world units
+	 */
+	void RenderFoodSources(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area);
+
+	/**
+	 * Draws the bees in view in as much detail as the zoom allows. Close up, each bee's body and face are batched into
+	 * one draw call, with the face turned toward the bee's target and the outline colored if the bee is touching a
+	 * structure. Further out each bee becomes a square in the same batch, and furthest out the heatmap of bees per
+	 * cell is drawn instead, which costs the same however many bees are in view
+	 * @Param window: The window that the snapshot is being rendered to
+	 * @Param snapshot: The state of the world being drawn
+	 * @Param area: The part of the world in view, in world units
+	 * @Param zoom: The number of world units covered by one pixel of the window
+	 */
+	void RenderBees(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area,
+		const float& zoom);
+
+	/**
+	 * Draws the outline and entity counts of every cell in view
+	 * @Param window: The window that the snapshot is being rendered to
+	 * @Param snapshot: The state of the world being drawn
+	 * @Param area: The part of the world in view, in world units
+	 */
+	void RenderGrid(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area);
+
+	/**
+	 * Draws every wasp in view
+	 * @Param window: The window that the snapshot is being rendered to
+	 * @Param snapshot: The state of the world being drawn
+	 * @Param area: The part of the world in view, in world units
+	 */
+	void RenderWasps(sf::RenderWindow& window, const WorldSnapshot& snapshot, const sf::FloatRect& area);
+
+	/**
+	 * Gathers the hives and food sources a bee in a cell could be touching, the same ones the simulation checks
+	 * @Param snapshot: The state of the world being drawn
+	 * @Param cell: The cell the bees being drawn are registered in
+	 */
+	void FindStructuresAround(const WorldSnapshot& snapshot, const WorldSnapshot::CellState& cell);
+
+	/**
+	 * Determines whether a bee's body overlaps any of the structures gathered by the last FindStructuresAround call
+	 * @Param position: The center of the bee's body
+	 * @Return: True if the bee's outline should be drawn in the alert color
+	 */
+	bool TouchingStructure(const sf::Vector2f& position) const;
+
+	/**
+	 * Finds the HUD of a hive, creating it the first time the hive is drawn
+	 * @Param hive: The state of the hive being drawn
+	 * @Return: The hive's display, holding a copy of the state it was last drawn with
+	 */
+	HiveDisplay& HiveDisplayFor(const WorldSnapshot::HiveState& hive);
+
+	BeeRenderer mBeeRenderer;
+	DensityMap mDensityMap;
+	std::vector<std::unique_ptr<HiveDisplay>> mHiveDisplays;
+	std::vector<sf::Vertex> mHUDVertices;
+	std::vector<std::uint32_t> mHUDHives;
+	std::vector<std::uint32_t> mVisibleHives;
+	std::vector<sf::FloatRect> mStructures;
+	sf::RectangleShape mHiveBody;
+	sf::RectangleShape mFoodSourceBody;
+	sf::RectangleShape mCellBorder;
+	sf::CircleShape mWaspBody;
+	TextLayer mFoodSourceLabels;
+	TextLayer mCellLabels;
+	sf::Clock mFrameClock;
+	Detail mDetail;
+	std::uint32_t mDrawnHiveCount;
+	std::uint32_t mDrawnFoodSourceCount;
+	std::uint32_t mDrawnWaspCount;
+	bool mGridVisible;
+
+};
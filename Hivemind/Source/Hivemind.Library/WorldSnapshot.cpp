@@ -0,0 +1,153 @@
+#include "pch.h"
+#include "WorldSnapshot.h"
+
+
+using namespace std;
+
+WorldSnapshot::WorldSnapshot() :
+	mCellSize(CollisionGrid::DEFAULT_NODE_SIZE), mTickCount(0), mCells(), mCellIndices(), mHives(), mFoodSources(), mBees(),
+	mWasps()
+{
+}
+
+void WorldSnapshot::Capture()
+{
+	auto grid = CollisionGrid::GetInstance();
+	Reset(grid->GetNodeSize(), World::GetInstance()->GetClock().GetTickCount());
+
+	grid->QueryAll([this](CollisionNode& node)
+	{
+		BeginCell(node.GetCell());
+		for (auto iter = node.Hives().begin(); iter != node.Hives().end(); ++iter)
+		{
+			(*iter)->AddToSnapshot(*this);
+		}
+		for (auto iter = node.FoodSources().begin(); iter != node.FoodSources().end(); ++iter)
+		{
+			(*iter)->AddToSnapshot(*this);
+		}
+		for (auto iter = node.Bees().begin(); iter != node.Bees().end(); ++iter)
+		{
+			(*iter)->AddToSnapshot(*this);
+		}
+		for (auto iter = node.Wasps().begin(); iter != node.Wasps().end(); ++iter)
+		{
+			(*iter)->AddToSnapshot(*this);
+		}
+	});
+}
+
+void WorldSnapshot::Reset(const int& cellSize, const uint64_t& tickCount)
+{
+	mCellSize = cellSize;
+	mTickCount = tickCount;
+	mCells.clear();
+	mCellIndices.clear();
+	mHives.clear();
+	mFoodSources.clear();
+	mBees.clear();
+	mWasps.clear();
+}
+
+void WorldSnapshot::BeginCell(const sf::Vector2i& cell)
+{
+	auto index = static_cast<uint32_t>(mCells.size());
+	if (!mCellIndices.emplace(CollisionGrid::KeyFromCell(cell), index).second)
+	{
+		throw runtime_error("Cell has already been captured");
+	}
+
+	CellState state;
+	state.mCell = cell;
+	state.mFirstHive = static_cast<uint32_t>(mHives.size());
+	state.mHiveCount = 0;
+	state.mFirstFoodSource = static_cast<uint32_t>(mFoodSources.size());
+	state.mFoodSourceCount = 0;
+	state.mFirstBee = static_cast<uint32_t>(mBees.size());
+	state.mBeeCount = 0;
+	state.mFirstWasp = static_cast<uint32_t>(mWasps.size());
+	state.mWaspCount = 0;
+	mCells.push_back(state);
+}
+
+void WorldSnapshot::AddHive(const HiveState& hive)
+{
+	CurrentCell().mHiveCount++;
+	mHives.push_back(hive);
+}
+
+void WorldSnapshot::AddFoodSource(const FoodSourceState& foodSource)
+{
+	CurrentCell().mFoodSourceCount++;
+	mFoodSources.push_back(foodSource);
+}
+
+void WorldSnapshot::AddBee(const BeeState& bee)
+{
+	CurrentCell().mBeeCount++;
+	mBees.push_back(bee);
+}
+
+void WorldSnapshot::AddWasp(const WaspState& wasp)
+{
+	CurrentCell().mWaspCount++;
+	mWasps.push_back(wasp);
+}
+
+const WorldSnapshot::CellState* WorldSnapshot::FindCell(const sf::Vector2i& cell) const
+{
+	auto iter = mCellIndices.find(CollisionGrid::KeyFromCell(cell));
+	return (iter != mCellIndices.end()) ? &mCells[iter->second] : nullptr;
+}
+
+sf::Vector2i WorldSnapshot::CellFromPosition(const sf::Vector2f& position) const
+{
+	return sf::Vector2i(
+		static_cast<int>(floor(position.x / mCellSize)),
+		static_cast<int>(floor(position.y / mCellSize)));
+}
+
+const vector<WorldSnapshot::CellState>& WorldSnapshot::Cells() const
+{
+	return mCells;
+}
+
+const vector<WorldSnapshot::HiveState>& WorldSnapshot::Hives() const
+{
+	return mHives;
+}
+
+const vector<WorldSnapshot::FoodSourceState>& WorldSnapshot::FoodSources() const
+{
+	return mFoodSources;
+}
+
+const vector<WorldSnapshot::BeeState>& WorldSnapshot::Bees() const
+{
+	return mBees;
+}
+
+const vector<WorldSnapshot::WaspState>& WorldSnapshot::Wasps() const
+{
+	return mWasps;
+}
+
+int WorldSnapshot::GetCellSize() const
+{
+	return mCellSize;
+}
+
+uint64_t WorldSnapshot::GetTickCount() const
+{
+	return mTickCount;
+}
+
+WorldSnapshot::CellState& WorldSnapshot::CurrentCell()
+{
+	if (mCells.empty())
+	{
+		throw runtime_error("No cell has been started");
+	}
+
+	return mCells.back();
+}
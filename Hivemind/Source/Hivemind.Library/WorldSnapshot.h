@@ -0,0 +1,256 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "CollisionGrid.h"
+
+
+/**
+ * Everything the renderer needs to draw one tick of the simulation, copied out of the live world so that it can be
+ * drawn on another thread while the simulation keeps stepping. Entities are grouped by the collision cell they were
+ * registered in, so the renderer can cull a snapshot the same way the collision grid is culled. A snapshot is plain
+ * data and never refers back to the entities it was taken from
+ */
+class WorldSnapshot
+{
+
+public:
+
+	/**
+	 * Only what the simulation already holds. The face's heading and the outline's color are worked out by the
+	 * renderer, for the bees in view
+	 */
+	struct BeeState
+	{
+		sf::Vector2f mPosition;
+		sf::Vector2f mTarget;
+		float mRadius;
+		float mFaceLength;
+		sf::Color mFillColor;
+	};
+
+	struct HiveState
+	{
+		sf::Vector2f mPosition;
+		sf::Vector2f mDimensions;
+		std::uint32_t mId;
+		int mOnlookerCount;
+		int mEmployeeCount;
+		int mDroneCount;
+		int mGuardCount;
+		int mQueenCount;
+		float mStructuralComb;
+		float mHoneyComb;
+		float mBroodComb;
+		float mFoodAmount;
+	};
+
+	struct FoodSourceState
+	{
+		std::uint64_t mId;
+		sf::Vector2f mPosition;
+		sf::Vector2f mDimensions;
+		float mFoodAmount;
+		float mMaxFoodAmount;
+	};
+
+	struct WaspState
+	{
+		sf::Vector2f mPosition;
+	};
+
+	/**
+	 * The entities registered in one collision cell, as ranges of the snapshot's entity lists
+	 */
+	struct CellState
+	{
+		sf::Vector2i mCell;
+		std::uint32_t mFirstHive;
+		std::uint32_t mHiveCount;
+		std::uint32_t mFirstFoodSource;
+		std::uint32_t mFoodSourceCount;
+		std::uint32_t mFirstBee;
+		std::uint32_t mBeeCount;
+		std::uint32_t mFirstWasp;
+		std::uint32_t mWaspCount;
+	};
+
+#pragma region Construction/Copy/Assignment
+
+	WorldSnapshot();
+
+	~WorldSnapshot() = default;
+
+	WorldSnapshot(const WorldSnapshot& rhs) = default;
+
+	WorldSnapshot& operator=(const WorldSnapshot& rhs) = default;
+
+	WorldSnapshot(WorldSnapshot&& rhs) = default;
+
+	WorldSnapshot& operator=(WorldSnapshot&& rhs) = default;
+
+#pragma endregion
+
+	/**
+	 * Replaces the contents of the snapshot with the current state of the world. Only state the simulation already
+	 * holds is copied, so a capture costs a copy per entity and no queries. Must be called between steps, on the
+	 * thread that runs the simulation
+	 */
+	void Capture();
+
+	/**
+	 * Empties the snapshot, keeping its storage for the next capture
+	 * @Param cellSize: The size of the collision cells the entities will be grouped by
+	 * @Param tickCount: The number of steps the simulation had taken when the snapshot was taken
+	 */
+	void Reset(const int& cellSize, const std::uint64_t& tickCount);
+
+	/**
+	 * Starts a new cell. Entities added after this call are grouped under it
+	 * @Param cell: The coordinates of the cell
+	 * @Exception: Thrown if the cell has already been started since the last Reset
+	 */
+	void BeginCell(const sf::Vector2i& cell);
+
+	/**
+	 * Adds a hive to the current cell
+	 * @Param hive: The state of the hive
+	 */
+	void AddHive(const HiveState& hive);
+
+	/**
+	 * Adds a food source to the current cell
+	 * @Param foodSource: The state of the food source
+	 */
+	void AddFoodSource(const FoodSourceState& foodSource);
+
+	/**
+	 * Adds a bee to the current cell
+	 * @Param bee: The state of the bee
+	 */
+	void AddBee(const BeeState& bee);
+
+	/**
+	 * Adds a wasp to the current cell
+	 * @Param wasp: The state of the wasp
+	 */
+	void AddWasp(const WaspState& wasp);
+
+	/**
+	 * Visits every cell of the snapshot overlapping an axis aligned box, in no particular order. Mirrors
+	 * CollisionGrid::QueryVisible, so a box larger than the world costs no more than the world itself
+	 * @Param area: The box being queried, in world units
+	 * @Param visitor: Callable taking a const CellState&
+	 */
+	template <typename Visitor>
+	void QueryVisible(const sf::FloatRect& area, const Visitor& visitor) const;
+
+	/**
+	 * Finds the entities captured in one cell
+	 * @Param cell: The coordinates of the cell
+	 * @Return: The cell's entities, or nullptr if nothing was registered in the cell
+	 */
+	const CellState* FindCell(const sf::Vector2i& cell) const;
+
+	/**
+	 * Determines which cell of the snapshot a position falls in
+	 * @Param position: A position in world units
+	 * @Return: The coordinates of the cell
+	 */
+	sf::Vector2i CellFromPosition(const sf::Vector2f& position) const;
+
+	/**
+	 * Accessor method for the cells of the snapshot
+	 * @Return: Every cell that held an entity, in the order they were captured
+	 */
+	const std::vector<CellState>& Cells() const;
+
+	/**
+	 * Accessor method for the hives of the snapshot
+	 * @Return: Every hive, grouped by cell
+	 */
+	const std::vector<HiveState>& Hives() const;
+
+	/**
+	 * Accessor method for the food sources of the snapshot
+	 * @Return: Every food source, grouped by cell
+	 */
+	const std::vector<FoodSourceState>& FoodSources() const;
+
+	/**
+	 * Accessor method for the bees of the snapshot
+	 * @Return: Every bee, grouped by cell
+	 */
+	const std::vector<BeeState>& Bees() const;
+
+	/**
+	 * Accessor method for the wasps of the snapshot
+	 * @Return: Every wasp, grouped by cell
+	 */
+	const std::vector<WaspState>& Wasps() const;
+
+	/**
+	 * Accessor method for the size of the cells the snapshot is grouped by
+	 * @Return: The width and height of a cell, in world units
+	 */
+	int GetCellSize() const;
+
+	/**
+	 * Accessor method for the tick the snapshot was taken on
+	 * @Return: The number of steps the simulation had taken
+	 */
+	std::uint64_t GetTickCount() const;
+
+private:
+
+	/**
+	 * Accessor method for the cell entities are currently being added to
+	 * @Return: The last cell started by BeginCell
+	 * @Exception: Thrown if no cell has been started
+	 */
+	CellState& CurrentCell();
+
+	int mCellSize;
+	std::uint64_t mTickCount;
+	std::vector<CellState> mCells;
+	std::unordered_map<std::uint64_t, std::uint32_t> mCellIndices;
+	std::vector<HiveState> mHives;
+	std::vector<FoodSourceState> mFoodSources;
+	std::vector<BeeState> mBees;
+	std::vector<WaspState> mWasps;
+
+};
+
+template <typename Visitor>
+void WorldSnapshot::QueryVisible(const sf::FloatRect& area, const Visitor& visitor) const
+{
+	auto first = CellFromPosition(sf::Vector2f(area.left, area.top));
+	auto last = CellFromPosition(sf::Vector2f(area.left + area.width, area.top + area.height));
+	auto cellCount = static_cast<std::uint64_t>(last.x - first.x + 1) * static_cast<std::uint64_t>(last.y - first.y + 1);
+
+	if (cellCount <= mCells.size())
+	{
+		for (int y = first.y; y <= last.y; ++y)
+		{
+			for (int x = first.x; x <= last.x; ++x)
+			{
+				auto iter = mCellIndices.find(CollisionGrid::KeyFromCell(sf::Vector2i(x, y)));
+				if (iter != mCellIndices.end())
+				{
+					visitor(mCells[iter->second]);
+				}
+			}
+		}
+		return;
+	}
+
+	for (auto iter = mCells.begin(); iter != mCells.end(); ++iter)
+	{
+		const auto& cell = iter->mCell;
+		if (cell.x >= first.x && cell.x <= last.x && cell.y >= first.y && cell.y <= last.y)
+		{
+			visitor(*iter);
+		}
+	}
+}
@@ -1,13 +1,9 @@
 #pragma once
 
-#include <SDKDDKVer.h>
-#define WIN32_LEAN_AND_MEAN             // Exclude rarely-used stuff from Windows headers
-
 
 //////////////////////////////
 //  Program Dependencies  ///
 ////////////////////////////
-#include <windows.h>
 #include <cstdlib>
 #include <SFML/Graphics.hpp>
 #include <SFML/System/Vector2.hpp>
@@ -23,6 +19,17 @@
 #include <chrono>
 #include <map>
 #include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+// The simulation core is platform independent; only the desktop front end pulls in windows.h
+#ifndef UNREFERENCED_PARAMETER
+#define UNREFERENCED_PARAMETER(P) (void)(P)
+#endif
 
 
 ///////////////////////////
@@ -47,4 +54,18 @@
 #include "HiveHUD.h"
 #include "Wasp.h"
 #include "WaspManager.h"
-#include "PerlinNoise.h"
\ No newline at end of file
+#include "PerlinNoise.h"
+#include "SimulationClock.h"
+#include "RandomStream.h"
+#include "ThreadPool.h"
+#include "ObjectPool.h"
+#include "Handle.h"
+#include "AliasTable.h"
+#include "FoodSourceKnowledge.h"
+#include "BeeRenderer.h"
+#include "DensityMap.h"
+#include "TripleBuffer.h"
+#include "WorldSnapshot.h"
+#include "TextLayer.h"
+#include "WorldRenderer.h"
+#include "World.h"
\ No newline at end of file
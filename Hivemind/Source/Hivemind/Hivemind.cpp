@@ -25,8 +25,10 @@ using namespace std::chrono;
 */
 
 const float CAMERA_SPEED = 350.0f;
-sf::Clock deltaClock;
+const double MAX_TIME_SCALE = 1024.0;
+const float RATE_SAMPLE_PERIOD = 0.5f;
 sf::Clock uiDeltaClock;
+sf::Clock rateClock;
 
 int main(int argc, char* argv[])
 {
@@ -60,20 +62,58 @@ int main(int argc, char* argv[])
 	fpsMeter.setPosition(0, 0);
 	fpsMeter.setFillColor(sf::Color(200, 200, 200));
 	
-	FlowFieldManager::GetInstance();
+	auto world = World::GetInstance();
 	auto beeManager = BeeManager::GetInstance();
-	auto hiveManager = HiveManager::GetInstance();
-	auto foodSourceManager = FoodSourceManager::GetInstance();
-	auto collisionGrid = CollisionGrid::GetInstance();
-	auto waspManager = WaspManager::GetInstance();
 
 	string worldConfig = argc >= 2 ? argv[1] : "big_world.json";
-	WorldGenerator::GetInstance()->Generate(worldConfig);
+	world->Load(worldConfig);
 	view.setCenter(HiveManager::GetInstance()->GetHive(0)->GetCenterTarget());
+	WorldRenderer renderer;
 
-	bool running = false;
-	deltaClock.restart();
+	// The simulation steps on its own thread and publishes a snapshot after every update, while this thread keeps
+	// the window, since SFML only delivers events to the thread that created it. Requests from the keyboard are
+	// handed over through atomics and applied between updates, so the UI never touches the live world
+	atomic<bool> running(false);
+	atomic<bool> quit(false);
+	atomic<bool> toggleFlowFields(false);
+	atomic<double> timeScale(world->GetClock().GetTimeScale());
+	thread simulation([&]()
+	{
+		sf::Clock deltaClock;
+		while (!quit)
+		{
+			if (toggleFlowFields.exchange(false))
+			{
+				beeManager->ToggleEmployeeFlowFields();
+			}
+			world->GetClock().SetTimeScale(timeScale);
+
+			uint32_t steps = 0;
+			if (running)
+			{
+				double realDeltaTime = deltaClock.restart().asSeconds();
+				steps = world->Update(realDeltaTime);
+			}
+			else
+			{	// Time spent paused is never banked
+				deltaClock.restart();
+			}
+
+			if (steps == 0)
+			{	// Nothing was due, so yield rather than spin until the next fixed step
+				this_thread::sleep_for(milliseconds(1));
+			}
+		}
+	});
+
+	uint32_t frameCount = 0;
+	uint64_t sampledTickCount = world->ReadSnapshot().GetTickCount();
+	float renderRate = 0.0f;
+	float simulationRate = 0.0f;
+	std::array<size_t, 11> shownCounters;
+	shownCounters.fill(SIZE_MAX);
 	uiDeltaClock.restart();
+	rateClock.restart();
 
 	while (window.isOpen())
 	{
@@ -95,11 +135,21 @@ int main(int argc, char* argv[])
 			{
 				if (event.key.code == sf::Keyboard::Numpad1)
 				{
-					collisionGrid->ToggleGridVisualization();
+					renderer.ToggleGridVisualization();
 				}
 				if (event.key.code == sf::Keyboard::Numpad2)
 				{
-					beeManager->ToggleEmployeeFlowFields();
+					toggleFlowFields = true;
+				}
+				if (event.key.code == sf::Keyboard::Add)
+				{	// Warp the simulation by running more fixed steps per update
+					auto warped = timeScale * 2.0;
+					timeScale = warped > MAX_TIME_SCALE ? MAX_TIME_SCALE : warped;
+				}
+				if (event.key.code == sf::Keyboard::Subtract)
+				{
+					auto warped = timeScale / 2.0;
+					timeScale = warped < 1.0 ? 1.0 : warped;
 				}
 
 				if (event.key.code == sf::Keyboard::Left || event.key.code == sf::Keyboard::A)
@@ -150,7 +200,6 @@ int main(int argc, char* argv[])
 				if (event.key.code == sf::Keyboard::Space)
 				{
 					running = !running;
-					deltaClock.restart();
 				}
 			}
 
@@ -175,16 +224,6 @@ int main(int argc, char* argv[])
 			window.close();
 		}
 
-		// Handle business logic updates
-		if (running)
-		{
-			double deltaTime = deltaClock.restart().asSeconds();
-			hiveManager->Update(window, deltaTime);
-			beeManager->Update(window, deltaTime);
-			foodSourceManager->Update(window, deltaTime); 
-			waspManager->Update(window, deltaTime);
-		}
-
 		auto uiDeltaTime = uiDeltaClock.restart().asSeconds();
 		view.move(cameraMovement * totalZoom * uiDeltaTime);
 
@@ -195,15 +234,49 @@ int main(int argc, char* argv[])
 			sf::Vector2f(view.getCenter().x - view.getSize().x / 2, view.getCenter().y - view.getSize().y / 2));
 		window.setView(view);
 
-		hiveManager->Render(window);
-		foodSourceManager->Render(window);
-		beeManager->Render(window);
-		collisionGrid->Render(window);
-		waspManager->Render(window);
+		// The snapshot stays untouched by the simulation until the next read, however far the simulation runs ahead
+		const auto& snapshot = world->ReadSnapshot();
+		renderer.Render(window, snapshot);
+
+		// Both loops' rates are sampled over the same period, the simulation's from the ticks its snapshots carry
+		++frameCount;
+		auto sampleTime = rateClock.getElapsedTime().asSeconds();
+		if (sampleTime >= RATE_SAMPLE_PERIOD)
+		{
+			renderRate = frameCount / sampleTime;
+			simulationRate = (snapshot.GetTickCount() - sampledTickCount) / sampleTime;
+			frameCount = 0;
+			sampledTickCount = snapshot.GetTickCount();
+			rateClock.restart();
+		}
+
+		// Drawn against total counts show how much of the world the culled render pass skipped this frame. The text is
+		// only laid out again when one of the numbers it shows has changed
+		std::array<size_t, 11> counters = { static_cast<size_t>(renderRate), static_cast<size_t>(simulationRate),
+			renderer.GetDrawnBeeCount(), snapshot.Bees().size(), static_cast<size_t>(renderer.GetDetail()),
+			renderer.GetDrawnFoodSourceCount(), snapshot.FoodSources().size(), renderer.GetDrawnHiveCount(),
+			snapshot.Hives().size(), renderer.GetDrawnWaspCount(), snapshot.Wasps().size() };
+		if (counters != shownCounters)
+		{
+			const char* beeDetails[] = { "bodies", "points", "heatmap" };
+			std::stringstream text;
+			text << "Render: " << counters[0] << " fps" << endl
+				<< "Simulation: " << counters[1] << " ticks/s" << endl
+				<< "Bees: " << counters[2] << " / " << counters[3] << " (" << beeDetails[counters[4]] << ")" << endl
+				<< "Food Sources: " << counters[5] << " / " << counters[6] << endl
+				<< "Hives: " << counters[7] << " / " << counters[8] << endl
+				<< "Wasps: " << counters[9] << " / " << counters[10];
+			fpsMeter.setString(text.str());
+			shownCounters = counters;
+		}
+		window.draw(fpsMeter);
 
 		window.display();
 		
 	}
 
+	quit = true;
+	simulation.join();
+
     return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -15,6 +15,9 @@
 #include <iostream>
 #include <chrono>
 #include <sstream>
+#include <thread>
+#include <atomic>
+#include <array>
 #include "BeeManager.h"
 #include "FoodSourceManager.h"
 #include "HiveManager.h"
@@ -25,4 +28,6 @@
 #include "CollisionNode.h"
 #include "CollisionGrid.h"
 #include "Wasp.h"
-#include "WaspManager.h"
\ No newline at end of file
+#include "WaspManager.h"
+#include "World.h"
+#include "WorldRenderer.h"
\ No newline at end of file